@@ -0,0 +1,354 @@
+/*
+ * 침습형 포인터와 스레드 지역 공유 포인터
+ * 파일명: 23_intrusive_local_ptr.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 23_intrusive_local_ptr 23_intrusive_local_ptr.cpp
+ * 실행: ./23_intrusive_local_ptr (Linux/Mac) 또는 23_intrusive_local_ptr.exe (Windows)
+ */
+
+/*
+주제: 가벼운 공유 소유권 (Intrusive / Local Shared Ownership)
+정의: 22_shared_ptr.cpp와 chapter08/05의 sharedPtrExample은 std::shared_ptr을 쓴다.
+      shared_ptr은 make_shared를 쓰지 않으면 객체와 별도로 제어 블록을 할당하고,
+      한 스레드 안에서만 공유하더라도 복사/소멸마다 원자적(atomic) 참조 카운트 연산을 한다.
+      여러 스레드가 같은 객체를 복사하면 카운트가 든 캐시 라인이 코어 사이를 오간다(cache-line bouncing).
+
+핵심 개념: intrusive_ptr, RefCounted, Counted<T>, local_shared_ptr
+정의:
+- intrusive_ptr: 참조 카운트를 객체 안에 둔다. 제어 블록이 없고 포인터 크기가 raw 포인터와 같다
+- RefCounted<Derived, Policy>: 카운트를 제공하는 기반 클래스. Policy로 원자적/비원자적 카운트를 고른다
+- Counted<T>: 기존 클래스(Resource 등)를 고치지 않고 카운트를 붙이는 포장. T의 멤버를 그대로 쓸 수 있다
+- local_shared_ptr: 한 스레드 안에서만 복사하는 비원자적 공유 포인터.
+  fromShared()로 기존 shared_ptr을 받으면 원자적 카운트는 한 번만 올리고, 그 뒤 스레드 안의 복사는 일반 정수 연산이다
+*/
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <utility>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+using namespace std;
+
+// ---- 참조 카운트 정책 ----
+struct AtomicCount {
+    atomic<uint32_t> count{0};
+
+    void increment() noexcept { count.fetch_add(1, memory_order_relaxed); }
+    // 마지막 참조를 놓은 스레드가 다른 스레드의 쓰기를 모두 본 뒤에 삭제하도록 acq_rel
+    bool decrement() noexcept { return count.fetch_sub(1, memory_order_acq_rel) == 1; }
+    uint32_t value() const noexcept { return count.load(memory_order_relaxed); }
+};
+
+struct LocalCount {
+    uint32_t count = 0;
+
+    void increment() noexcept { ++count; }
+    bool decrement() noexcept { return --count == 0; }
+    uint32_t value() const noexcept { return count; }
+};
+
+// 카운트를 객체 안에 넣는 기반 클래스 (CRTP: 가상 소멸자 없이 Derived로 삭제)
+template<typename Derived, typename CountPolicy = AtomicCount>
+class RefCounted {
+private:
+    mutable CountPolicy refs;
+
+protected:
+    RefCounted() = default;
+    RefCounted(const RefCounted&) noexcept {}  // 복사된 객체는 새 카운트로 시작
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+    ~RefCounted() = default;
+
+public:
+    void addRef() const noexcept { refs.increment(); }
+    void release() const noexcept {
+        if (refs.decrement()) delete static_cast<const Derived*>(this);
+    }
+    uint32_t refCount() const noexcept { return refs.value(); }
+};
+
+// 기존 클래스에 카운트를 붙인다: Counted<Resource>는 Resource처럼 쓸 수 있다
+template<typename T, typename CountPolicy = AtomicCount>
+class Counted : public T, public RefCounted<Counted<T, CountPolicy>, CountPolicy> {
+public:
+    using T::T;
+};
+
+template<typename T>
+class intrusive_ptr {
+private:
+    T* ptr = nullptr;
+
+    template<typename U> friend class intrusive_ptr;
+
+public:
+    intrusive_ptr() noexcept = default;
+    intrusive_ptr(nullptr_t) noexcept {}
+
+    // raw 포인터를 받으면 참조를 하나 늘린다 (이미 다른 intrusive_ptr가 가리키는 객체도 안전)
+    explicit intrusive_ptr(T* p) noexcept : ptr(p) {
+        if (ptr) ptr->addRef();
+    }
+
+    intrusive_ptr(const intrusive_ptr& other) noexcept : intrusive_ptr(other.ptr) {}
+    intrusive_ptr(intrusive_ptr&& other) noexcept : ptr(exchange(other.ptr, nullptr)) {}
+
+    template<typename U, typename = enable_if_t<is_convertible<U*, T*>::value>>
+    intrusive_ptr(const intrusive_ptr<U>& other) noexcept : intrusive_ptr(static_cast<T*>(other.ptr)) {}
+
+    ~intrusive_ptr() {
+        if (ptr) ptr->release();
+    }
+
+    intrusive_ptr& operator=(intrusive_ptr other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    void swap(intrusive_ptr& other) noexcept { std::swap(ptr, other.ptr); }
+    void reset() noexcept { intrusive_ptr().swap(*this); }
+
+    T* get() const noexcept { return ptr; }
+    T& operator*() const noexcept { return *ptr; }
+    T* operator->() const noexcept { return ptr; }
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+    uint32_t use_count() const noexcept { return ptr ? ptr->refCount() : 0; }
+
+    friend bool operator==(const intrusive_ptr& a, const intrusive_ptr& b) noexcept { return a.ptr == b.ptr; }
+    friend bool operator!=(const intrusive_ptr& a, const intrusive_ptr& b) noexcept { return a.ptr != b.ptr; }
+};
+
+template<typename T, typename... Args>
+intrusive_ptr<T> make_intrusive(Args&&... args) {
+    return intrusive_ptr<T>(new T(forward<Args>(args)...));
+}
+
+// ---- 스레드 지역 공유 포인터 ----
+template<typename T>
+class local_shared_ptr {
+private:
+    // 제어 블록: 비원자적 카운트 + 객체를 해제하는 방법
+    struct ControlBlock {
+        uint32_t count = 1;
+#ifndef NDEBUG
+        thread::id owner = this_thread::get_id();  // 디버그 빌드에서 다른 스레드 사용을 잡아낸다
+#endif
+        virtual ~ControlBlock() = default;
+    };
+
+    struct InplaceBlock : ControlBlock {
+        T value;
+        template<typename... Args>
+        explicit InplaceBlock(Args&&... args) : value(forward<Args>(args)...) {}
+    };
+
+    struct SharedBlock : ControlBlock {
+        shared_ptr<T> keeper;  // 원자적 참조 하나를 블록 전체가 공유
+        explicit SharedBlock(shared_ptr<T> p) : keeper(move(p)) {}
+    };
+
+    T* ptr = nullptr;
+    ControlBlock* block = nullptr;
+
+    local_shared_ptr(T* p, ControlBlock* b) noexcept : ptr(p), block(b) {}
+
+    void checkThread() const noexcept {
+#ifndef NDEBUG
+        assert(!block || block->owner == this_thread::get_id());
+#endif
+    }
+
+    template<typename U, typename... Args>
+    friend local_shared_ptr<U> make_local_shared(Args&&... args);
+
+public:
+    local_shared_ptr() noexcept = default;
+    local_shared_ptr(nullptr_t) noexcept {}
+
+    // 기존 shared_ptr과 연결: 원자적 카운트는 여기서 한 번만 늘어난다
+    static local_shared_ptr fromShared(shared_ptr<T> shared) {
+        if (!shared) return {};
+        T* raw = shared.get();
+        return local_shared_ptr(raw, new SharedBlock(move(shared)));
+    }
+
+    local_shared_ptr(const local_shared_ptr& other) noexcept : ptr(other.ptr), block(other.block) {
+        checkThread();
+        if (block) ++block->count;
+    }
+    local_shared_ptr(local_shared_ptr&& other) noexcept
+        : ptr(exchange(other.ptr, nullptr)), block(exchange(other.block, nullptr)) {}
+
+    ~local_shared_ptr() {
+        checkThread();
+        if (block && --block->count == 0) delete block;
+    }
+
+    local_shared_ptr& operator=(local_shared_ptr other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    void swap(local_shared_ptr& other) noexcept {
+        std::swap(ptr, other.ptr);
+        std::swap(block, other.block);
+    }
+    void reset() noexcept { local_shared_ptr().swap(*this); }
+
+    T* get() const noexcept { return ptr; }
+    T& operator*() const noexcept { return *ptr; }
+    T* operator->() const noexcept { return ptr; }
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+    uint32_t use_count() const noexcept { return block ? block->count : 0; }
+};
+
+template<typename T, typename... Args>
+local_shared_ptr<T> make_local_shared(Args&&... args) {
+    using Block = typename local_shared_ptr<T>::InplaceBlock;
+    auto* block = new Block(forward<Args>(args)...);  // 객체와 카운트를 한 번에 할당
+    return local_shared_ptr<T>(&block->value, block);
+}
+
+// chapter08/05_smart_pointer_exception.cpp의 Resource
+class Resource {
+public:
+    int value;
+
+    Resource(int v) : value(v) {
+        cout << "Resource 생성: " << value << endl;
+    }
+
+    ~Resource() {
+        cout << "Resource 소멸: " << value << endl;
+    }
+
+    void process() {
+        cout << "Resource 처리: " << value << endl;
+    }
+};
+
+void takeResource(Resource& r) {
+    r.process();
+}
+
+// ---- 벤치마크 ----
+template<typename Func>
+double measureNs(long long operations, Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / operations;
+}
+
+// 복사 1000개를 만들었다가 모두 소멸시키기를 반복 (복사 + 소멸 한 쌍당 ns)
+template<typename Ptr>
+double copyDestroyNs(const Ptr& source, int rounds) {
+    vector<Ptr> copies;
+    copies.reserve(1000);
+    return measureNs(static_cast<long long>(rounds) * 1000, [&] {
+        for (int r = 0; r < rounds; r++) {
+            for (int i = 0; i < 1000; i++) copies.push_back(source);
+            copies.clear();
+        }
+    });
+}
+
+struct Payload {
+    long long data[4] = {1, 2, 3, 4};
+};
+
+// 여러 스레드가 같은 객체의 포인터를 복사/소멸 (스레드 수와 무관하게 총 작업량 고정)
+template<typename MakeLocal>
+double sharedContentionNs(int threadCount, long long totalPairs, MakeLocal makeLocal) {
+    long long perThread = totalPairs / threadCount;
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&] {
+            auto local = makeLocal();  // 스레드가 쓸 포인터 (공유 카운트 또는 지역 카운트)
+            vector<decltype(local)> copies;
+            copies.reserve(64);
+            for (long long i = 0; i < perThread; i += 64) {
+                for (int k = 0; k < 64; k++) copies.push_back(local);
+                copies.clear();
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / totalPairs;
+}
+
+int main() {
+    cout << "=== 기존 Resource에 카운트 붙이기 ===" << endl;
+    {
+        auto res = make_intrusive<Counted<Resource>>(50);
+        cout << "intrusive_ptr 크기: " << sizeof(res) << "바이트 (shared_ptr: " << sizeof(shared_ptr<Resource>) << "바이트)" << endl;
+        {
+            intrusive_ptr<Counted<Resource>> copy = res;
+            cout << "참조 카운트: " << res.use_count() << endl;
+            takeResource(*copy);  // Resource&로 그대로 전달
+        }
+        cout << "복사본 소멸 후 참조 카운트: " << res.use_count() << endl;
+
+        // raw 포인터에서 다시 만들어도 카운트가 객체 안에 있으므로 안전
+        Counted<Resource>* raw = res.get();
+        intrusive_ptr<Counted<Resource>> again(raw);
+        cout << "raw 포인터에서 다시 만든 뒤 참조 카운트: " << again.use_count() << endl;
+    }
+
+    cout << "\n=== local_shared_ptr ===" << endl;
+    {
+        auto local = make_local_shared<Resource>(60);
+        auto copy = local;
+        cout << "참조 카운트: " << local.use_count() << endl;
+        copy->process();
+
+        // sharedPtrExample처럼 shared_ptr로 만든 자원을 스레드 안에서 가볍게 공유
+        shared_ptr<Resource> shared = make_shared<Resource>(70);
+        {
+            auto bridged = local_shared_ptr<Resource>::fromShared(shared);
+            vector<local_shared_ptr<Resource>> many(100, bridged);
+            cout << "지역 복사 " << bridged.use_count() << "개, shared_ptr 카운트: " << shared.use_count() << endl;
+        }
+        cout << "지역 복사 소멸 후 shared_ptr 카운트: " << shared.use_count() << endl;
+    }
+
+    cout << "\n=== 한 스레드에서 복사 + 소멸 (쌍당 ns) ===" << endl;
+    // libstdc++의 shared_ptr은 프로세스가 스레드를 한 번도 만들지 않았으면 원자적 연산을 생략한다.
+    // 실제 다중 스레드 프로그램과 같은 조건에서 재기 위해 스레드를 하나 만들었다가 끝낸다
+    thread([] {}).join();
+    const int ROUNDS = 20000;  // 2천만 쌍
+    Payload* rawTarget = new Payload();
+    auto madeShared = make_shared<Payload>();
+    shared_ptr<Payload> separateShared(new Payload());  // 제어 블록을 따로 할당
+    auto atomicIntrusive = make_intrusive<Counted<Payload>>();
+    auto localIntrusive = make_intrusive<Counted<Payload, LocalCount>>();
+    auto localShared = make_local_shared<Payload>();
+
+    cout << "raw 포인터 (카운트 없음): " << copyDestroyNs(rawTarget, ROUNDS) << endl;
+    cout << "shared_ptr (make_shared): " << copyDestroyNs(madeShared, ROUNDS) << endl;
+    cout << "shared_ptr (new로 생성):  " << copyDestroyNs(separateShared, ROUNDS) << endl;
+    cout << "intrusive_ptr (원자적):   " << copyDestroyNs(atomicIntrusive, ROUNDS) << endl;
+    cout << "intrusive_ptr (비원자적): " << copyDestroyNs(localIntrusive, ROUNDS) << endl;
+    cout << "local_shared_ptr:         " << copyDestroyNs(localShared, ROUNDS) << endl;
+    delete rawTarget;
+
+    cout << "\n=== 여러 스레드가 같은 객체를 공유 (쌍당 ns, 총 1600만 쌍) ===" << endl;
+    cout << "스레드 | shared_ptr | intrusive_ptr(원자적) | 스레드마다 local_shared_ptr" << endl;
+    const long long PAIRS = 16000000;
+    for (int threads : {1, 2, 4, 8}) {
+        double shared = sharedContentionNs(threads, PAIRS, [&] { return madeShared; });
+        double intrusive = sharedContentionNs(threads, PAIRS, [&] { return atomicIntrusive; });
+        double local = sharedContentionNs(threads, PAIRS, [&] { return local_shared_ptr<Payload>::fromShared(madeShared); });
+        cout << threads << " | " << shared << " | " << intrusive << " | " << local << endl;
+    }
+    cout << "하드웨어 스레드: " << thread::hardware_concurrency() << "개 "
+         << "(코어가 여러 개일 때 공유 카운트의 캐시 라인 이동 비용이 드러난다)" << endl;
+
+    return 0;
+}
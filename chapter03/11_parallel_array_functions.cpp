@@ -0,0 +1,261 @@
+/*
+ * 배열 함수의 병렬화
+ * 파일명: 11_parallel_array_functions.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 11_parallel_array_functions 11_parallel_array_functions.cpp
+ * 실행: ./11_parallel_array_functions (Linux/Mac) 또는 11_parallel_array_functions.exe (Windows)
+ */
+
+/*
+주제: 배열 함수의 병렬화 (Parallel Array Functions)
+정의: 10_array_functions.cpp의 calculateSum, doubleArray와 09_array_loops.cpp의 최대값 찾기를
+      여러 스레드로 나누어 처리하는 방법
+
+핵심 개념: 작업 분할, 거짓 공유, 임계 크기, 결정적 결과
+정의:
+- 작업 분할: 배열을 고정 크기 블록(chunk)으로 나누고 각 스레드가 연속된 블록들을 맡는다
+- 거짓 공유(false sharing): 서로 다른 스레드가 같은 캐시 라인(64바이트)에 쓰면
+  캐시 라인이 코어 사이를 오가며 느려진다. 부분 합을 64바이트 간격으로 두고,
+  doubleArray의 경계를 캐시 라인 단위로 맞춘다
+- 임계 크기: 스레드를 만드는 비용(수십 마이크로초)보다 작업이 작으면 단일 스레드로 처리한다
+- 결정적 결과: 블록 크기는 스레드 수와 무관하게 고정하고, 블록별 부분 결과를
+  블록 순서대로 합친다. 그래서 double 합계도 스레드 수와 관계없이 비트 단위로 같다
+*/
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <cstdint>
+#include <iomanip>
+#include <stdexcept>
+using namespace std;
+
+// 이 크기보다 작은 배열은 단일 스레드로 처리
+const size_t PARALLEL_THRESHOLD = 1 << 16;
+
+// 부분 결과를 나누는 단위. 스레드 수와 무관해야 결과가 결정적이다
+const size_t CHUNK_SIZE = 1 << 14;
+
+const size_t CACHE_LINE = 64;
+
+// 캐시 라인 하나를 통째로 차지하는 부분 결과 (거짓 공유 방지)
+template<typename T>
+struct alignas(CACHE_LINE) PaddedValue {
+    T value;
+};
+
+unsigned defaultThreadCount() {
+    unsigned hw = thread::hardware_concurrency();
+    return hw > 0 ? hw : 4;
+}
+
+// 블록 [0, chunkCount)를 스레드마다 연속 구간으로 나누어 chunkWork(블록 번호)를 실행
+template<typename Work>
+void forEachChunk(size_t chunkCount, unsigned threadCount, Work chunkWork) {
+    threadCount = static_cast<unsigned>(min<size_t>(threadCount, chunkCount));
+    if (threadCount <= 1) {
+        for (size_t c = 0; c < chunkCount; c++) chunkWork(c);
+        return;
+    }
+
+    vector<thread> workers;
+    workers.reserve(threadCount - 1);
+    auto runRange = [&](unsigned t) {
+        size_t first = chunkCount * t / threadCount;
+        size_t last = chunkCount * (t + 1) / threadCount;
+        for (size_t c = first; c < last; c++) chunkWork(c);
+    };
+    for (unsigned t = 1; t < threadCount; t++) {
+        workers.emplace_back(runRange, t);
+    }
+    runRange(0);  // 호출한 스레드도 일을 나눠 맡는다
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// 블록별 부분 결과를 만든 뒤 블록 순서대로 합친다
+template<typename T, typename Partial, typename Combine>
+T chunkedReduce(size_t size, unsigned threadCount, T initial, Partial partial, Combine combine) {
+    size_t chunkCount = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    vector<PaddedValue<T>> partials(chunkCount);
+
+    forEachChunk(chunkCount, threadCount, [&](size_t c) {
+        size_t begin = c * CHUNK_SIZE;
+        size_t end = min(size, begin + CHUNK_SIZE);
+        partials[c].value = partial(begin, end);  // 블록마다 한 번만 쓴다
+    });
+
+    T result = initial;
+    for (const auto& p : partials) {
+        result = combine(result, p.value);
+    }
+    return result;
+}
+
+// ---------- 10_array_functions.cpp의 원래 함수 (단일 스레드) ----------
+long long calculateSum(const int arr[], size_t size) {
+    long long sum = 0;  // int 대신 64비트로 누산 (큰 배열 오버플로 방지)
+    for (size_t i = 0; i < size; i++) {
+        sum += arr[i];
+    }
+    return sum;
+}
+
+void doubleArray(int arr[], size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        arr[i] *= 2;
+    }
+}
+
+int findMax(const int arr[], size_t size) {
+    int max = arr[0];
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i] > max) {
+            max = arr[i];
+        }
+    }
+    return max;
+}
+
+// ---------- 병렬 버전 ----------
+long long parallelCalculateSum(const int arr[], size_t size, unsigned threadCount = defaultThreadCount()) {
+    if (size < PARALLEL_THRESHOLD) {
+        return calculateSum(arr, size);
+    }
+    return chunkedReduce<long long>(size, threadCount, 0LL,
+        [arr](size_t begin, size_t end) { return calculateSum(arr + begin, end - begin); },
+        [](long long a, long long b) { return a + b; });
+}
+
+// double 합계는 더하는 순서에 따라 결과가 달라지므로 블록 순서를 고정하는 것이 중요하다
+double parallelCalculateSum(const double arr[], size_t size, unsigned threadCount = defaultThreadCount()) {
+    auto serial = [arr](size_t begin, size_t end) {
+        double sum = 0.0;
+        for (size_t i = begin; i < end; i++) sum += arr[i];
+        return sum;
+    };
+    // 임계 크기 아래에서도 같은 블록 순서로 더해야 스레드 수와 무관하게 같은 값이 나온다
+    return chunkedReduce<double>(size, size < PARALLEL_THRESHOLD ? 1 : threadCount, 0.0, serial,
+                                 [](double a, double b) { return a + b; });
+}
+
+int parallelFindMax(const int arr[], size_t size, unsigned threadCount = defaultThreadCount()) {
+    if (size == 0) {
+        throw invalid_argument("빈 배열의 최대값");
+    }
+    if (size < PARALLEL_THRESHOLD) {
+        return findMax(arr, size);
+    }
+    return chunkedReduce<int>(size, threadCount, INT_MIN,
+        [arr](size_t begin, size_t end) { return findMax(arr + begin, end - begin); },
+        [](int a, int b) { return max(a, b); });
+}
+
+void parallelDoubleArray(int arr[], size_t size, unsigned threadCount = defaultThreadCount()) {
+    if (size < PARALLEL_THRESHOLD) {
+        doubleArray(arr, size);
+        return;
+    }
+    // 배열 시작 주소가 캐시 라인에 맞춰져 있다는 보장은 없다 (new/vector는 16바이트 정렬이 보통).
+    // 그래서 블록 경계를 배열 기준이 아니라 주소 기준 캐시 라인 경계에 두고,
+    // 첫 경계 앞의 몇 개 요소는 첫 블록이 함께 맡는다
+    static_assert((CHUNK_SIZE * sizeof(int)) % CACHE_LINE == 0, "블록 크기가 캐시 라인의 배수여야 합니다");
+    size_t misalignment = reinterpret_cast<uintptr_t>(arr) % CACHE_LINE;
+    size_t lead = misalignment == 0 ? 0 : (CACHE_LINE - misalignment) / sizeof(int);
+    size_t chunkCount = (size - lead + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    forEachChunk(chunkCount, threadCount, [arr, size, lead](size_t c) {
+        size_t begin = c == 0 ? 0 : lead + c * CHUNK_SIZE;
+        size_t end = min(size, lead + (c + 1) * CHUNK_SIZE);
+        doubleArray(arr + begin, end - begin);
+    });
+}
+
+template<typename Func>
+double measureMs(Func func, int repeat = 3) {
+    double best = 1e30;
+    for (int r = 0; r < repeat; r++) {
+        auto start = chrono::steady_clock::now();
+        func();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+int main() {
+    cout << "=== 작은 배열 (단일 스레드 경로) ===" << endl;
+    int numbers[] = {1, 2, 3, 4, 5};
+    cout << "합계: " << parallelCalculateSum(numbers, 5) << endl;
+    cout << "최대값: " << parallelFindMax(numbers, 5) << endl;
+    parallelDoubleArray(numbers, 5);
+    cout << "2배 증가 후: ";
+    for (int n : numbers) cout << n << " ";
+    cout << endl;
+
+    cout << "\n=== 스레드 수와 무관한 결과 ===" << endl;
+    const size_t size = 10000000;
+    vector<int> ints(size);
+    vector<double> doubles(size);
+    for (size_t i = 0; i < size; i++) {
+        ints[i] = static_cast<int>((i * 2654435761u) % 2000001) - 1000000;
+        doubles[i] = 1.0 / static_cast<double>(i + 1) * ((i % 3 == 0) ? -1.0 : 1.0);
+    }
+
+    long long expectedSum = calculateSum(ints.data(), size);
+    int expectedMax = findMax(ints.data(), size);
+    double reference = parallelCalculateSum(doubles.data(), size, 1);
+    bool allSame = true;
+    for (unsigned threads : {1u, 2u, 3u, 4u, 7u, 8u, 16u}) {
+        long long sum = parallelCalculateSum(ints.data(), size, threads);
+        int max = parallelFindMax(ints.data(), size, threads);
+        double dsum = parallelCalculateSum(doubles.data(), size, threads);
+        bool same = sum == expectedSum && max == expectedMax && memcmp(&dsum, &reference, sizeof(double)) == 0;
+        allSame = allSame && same;
+        cout << setw(2) << threads << "개 스레드: int 합계 " << sum << ", 최대 " << max
+             << ", double 합계 " << setprecision(17) << dsum << (same ? "" : "  <-- 불일치") << endl;
+    }
+    cout << "결과: " << (allSame ? "모든 스레드 수에서 동일" : "불일치 발생") << endl;
+
+    vector<int> copy1 = ints, copy2 = ints;
+    doubleArray(copy1.data(), size);
+    parallelDoubleArray(copy2.data(), size, 8);
+    cout << "doubleArray 결과 일치: " << (copy1 == copy2 ? "예" : "아니오") << endl;
+
+    // 캐시 라인에 맞지 않는 시작 주소에서도 블록 경계는 캐시 라인 경계에 놓인다
+    doubleArray(copy1.data() + 3, size - 3);
+    parallelDoubleArray(copy2.data() + 3, size - 3, 8);
+    cout << "정렬되지 않은 시작 주소에서도 일치: " << (copy1 == copy2 ? "예" : "아니오") << endl;
+
+    cout << "\n=== 벤치마크: 배열 크기 × 스레드 수 (calculateSum, ms) ===" << endl;
+    cout << "하드웨어 스레드: " << thread::hardware_concurrency() << "개" << endl;
+    vector<unsigned> threadCounts = {1, 2, 4, 8};
+    cout << setw(12) << "크기" << setw(12) << "단일";
+    for (unsigned t : threadCounts) cout << setw(10) << (to_string(t) + "T");
+    cout << endl;
+
+    vector<int> data(1 << 25, 1);
+    long long sink = 0;
+    cout << fixed << setprecision(3);
+    for (size_t n = 1 << 12; n <= data.size(); n <<= 2) {
+        cout << setw(12) << n;
+        cout << setw(12) << measureMs([&] { sink += calculateSum(data.data(), n); });
+        for (unsigned t : threadCounts) {
+            // 임계 크기를 무시하고 강제로 나누어 보면 손익분기점을 확인할 수 있다
+            double ms = measureMs([&] {
+                sink += chunkedReduce<long long>(n, t, 0LL,
+                    [&data](size_t b, size_t e) { return calculateSum(data.data() + b, e - b); },
+                    [](long long a, long long b) { return a + b; });
+            });
+            cout << setw(10) << ms;
+        }
+        cout << endl;
+    }
+    cout << "(결과 확인용: " << sink << ")" << endl;
+    cout << "현재 임계 크기: " << PARALLEL_THRESHOLD << "개" << endl;
+
+    return 0;
+}
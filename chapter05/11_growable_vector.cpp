@@ -0,0 +1,464 @@
+/*
+ * 종합 활용 - 크기가 늘어나는 벡터 클래스
+ * 파일명: 11_growable_vector.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 11_growable_vector 11_growable_vector.cpp
+ * 실행: ./11_growable_vector (Linux/Mac) 또는 11_growable_vector.exe (Windows)
+ */
+
+/*
+주제: 크기가 늘어나는 벡터 (Growable Vector)
+정의: 10_simple_vector.cpp의 SimpleVector는 생성할 때 크기가 고정되고 push_back이 없다.
+      여기서는 요소를 계속 추가할 수 있는 실제 컨테이너로 확장한다.
+
+핵심 개념: 용량(capacity), 기하급수적 증가, 재배치, move_if_noexcept
+정의:
+- 크기(size)와 용량(capacity): 실제 요소 수와 미리 확보한 공간을 구분한다
+- 기하급수적 증가: 공간이 부족할 때 용량을 일정 배수로 늘리면
+  push_back 한 번의 평균 비용(분할 상환)이 O(1)이 된다
+- 재배치(relocation): 새 공간으로 요소를 옮기는 작업. 이동 생성자가 noexcept일 때만
+  이동하고, 아니면 복사하여 예외가 나도 원본이 그대로 남도록 한다 (강한 예외 안전성)
+- 자명한 재배치(trivially relocatable): 이동 후 원본을 소멸시키는 것이 memcpy와 같은 타입.
+  IsTriviallyRelocatable을 특수화하여 선택적으로 memcpy 경로를 사용한다
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+using namespace std;
+
+// 용량 증가 정책: 필요한 최소 크기를 받아 새 용량을 결정한다
+struct DoublingGrowth {
+    static size_t next(size_t current, size_t required) {
+        return max(required, current == 0 ? size_t(4) : current * 2);
+    }
+};
+
+struct GoldenGrowth {  // 1.5배: 메모리 낭비가 적고 해제한 블록을 재사용하기 쉽다
+    static size_t next(size_t current, size_t required) {
+        return max(required, current < 4 ? size_t(4) : current + current / 2);
+    }
+};
+
+// 기본적으로 자명하게 복사 가능한 타입만 memcpy로 재배치한다.
+// 힙 포인터만 가진 클래스처럼 안전한 타입은 특수화로 직접 선언한다.
+template<typename T>
+struct IsTriviallyRelocatable : is_trivially_copyable<T> {};
+
+template<typename T, typename Growth = DoublingGrowth>
+class SimpleVector {
+private:
+    T* items = nullptr;
+    size_t itemCount = 0;
+    size_t itemCapacity = 0;
+
+    static T* allocate(size_t n) {
+        return n > 0 ? static_cast<T*>(::operator new(n * sizeof(T))) : nullptr;
+    }
+
+    static void deallocate(T* p) {
+        ::operator delete(p);
+    }
+
+    static void destroy(T* first, T* last) {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    // 기존 요소들을 dest로 옮긴다. 예외가 나면 dest에 만든 것만 정리하고 원본은 유지
+    void relocateTo(T* dest) {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            if (itemCount > 0) {
+                memcpy(static_cast<void*>(dest), static_cast<const void*>(items), itemCount * sizeof(T));
+            }
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < itemCount; ++built) {
+                    ::new (static_cast<void*>(dest + built)) T(move_if_noexcept(items[built]));
+                }
+            }
+            catch (...) {
+                destroy(dest, dest + built);
+                throw;
+            }
+            destroy(items, items + itemCount);
+        }
+    }
+
+    void reallocate(size_t newCapacity) {
+        T* fresh = allocate(newCapacity);
+        try {
+            relocateTo(fresh);
+        }
+        catch (...) {
+            deallocate(fresh);
+            throw;
+        }
+        deallocate(items);
+        items = fresh;
+        itemCapacity = newCapacity;
+    }
+
+    // 꽉 찬 상태에서 추가: 새 요소를 먼저 만들어야 v.push_back(v[0])처럼
+    // 자기 자신의 요소를 인자로 넘겨도 안전하다
+    template<typename... Args>
+    T& growAndEmplace(Args&&... args) {
+        size_t newCapacity = Growth::next(itemCapacity, itemCount + 1);
+        T* fresh = allocate(newCapacity);
+        T* slot = fresh + itemCount;
+        try {
+            ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            deallocate(fresh);
+            throw;
+        }
+        try {
+            relocateTo(fresh);
+        }
+        catch (...) {
+            slot->~T();
+            deallocate(fresh);
+            throw;
+        }
+        deallocate(items);
+        items = fresh;
+        itemCapacity = newCapacity;
+        ++itemCount;
+        return *slot;
+    }
+
+public:
+    SimpleVector() = default;
+
+    explicit SimpleVector(size_t count, const T& value = T()) {
+        reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            push_back(value);
+        }
+    }
+
+    SimpleVector(initializer_list<T> init) {
+        reserve(init.size());
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    // 복사 생성자: 필요한 만큼만 할당
+    SimpleVector(const SimpleVector& other) {
+        reserve(other.itemCount);
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    // 이동 생성자: 버퍼 소유권만 넘긴다
+    SimpleVector(SimpleVector&& other) noexcept
+        : items(other.items), itemCount(other.itemCount), itemCapacity(other.itemCapacity) {
+        other.items = nullptr;
+        other.itemCount = 0;
+        other.itemCapacity = 0;
+    }
+
+    // 복사 후 교환(copy-and-swap)으로 강한 예외 안전성 보장
+    SimpleVector& operator=(const SimpleVector& other) {
+        if (this != &other) {
+            SimpleVector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    SimpleVector& operator=(SimpleVector&& other) noexcept {
+        if (this != &other) {
+            SimpleVector moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~SimpleVector() {
+        destroy(items, items + itemCount);
+        deallocate(items);
+    }
+
+    void swap(SimpleVector& other) noexcept {
+        std::swap(items, other.items);
+        std::swap(itemCount, other.itemCount);
+        std::swap(itemCapacity, other.itemCapacity);
+    }
+
+    // 용량 관리
+    void reserve(size_t newCapacity) {
+        if (newCapacity > itemCapacity) {
+            reallocate(newCapacity);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (itemCapacity > itemCount) {
+            reallocate(itemCount);
+        }
+    }
+
+    // 요소 추가/삭제
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (itemCount == itemCapacity) {
+            return growAndEmplace(std::forward<Args>(args)...);
+        }
+        T* slot = ::new (static_cast<void*>(items + itemCount)) T(std::forward<Args>(args)...);
+        ++itemCount;
+        return *slot;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        if (itemCount == 0) {
+            throw out_of_range("빈 벡터에서 pop_back 호출");
+        }
+        --itemCount;
+        items[itemCount].~T();
+    }
+
+    void resize(size_t newSize, const T& value = T()) {
+        if (newSize < itemCount) {
+            destroy(items + newSize, items + itemCount);
+            itemCount = newSize;
+            return;
+        }
+        if (newSize > itemCapacity) {
+            // 인자가 자기 요소를 가리킬 수 있으므로(v.resize(n, v[0])) 재할당 전에 먼저 값을 만든다
+            T copy(value);
+            reserve(newSize);
+            while (itemCount < newSize) {
+                emplace_back(copy);
+            }
+            return;
+        }
+        while (itemCount < newSize) {
+            emplace_back(value);
+        }
+    }
+
+    void clear() noexcept {
+        destroy(items, items + itemCount);
+        itemCount = 0;
+    }
+
+    // 연산자 오버로딩
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+
+    T& at(size_t index) {
+        if (index >= itemCount) {
+            throw out_of_range("인덱스 범위 초과: " + to_string(index));
+        }
+        return items[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= itemCount) {
+            throw out_of_range("인덱스 범위 초과: " + to_string(index));
+        }
+        return items[index];
+    }
+
+    // 반복자 (포인터를 그대로 사용)
+    T* begin() { return items; }
+    T* end() { return items + itemCount; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + itemCount; }
+
+    T* data() { return items; }
+    const T* data() const { return items; }
+    size_t size() const { return itemCount; }
+    size_t capacity() const { return itemCapacity; }
+    bool empty() const { return itemCount == 0; }
+
+    void display() const {
+        for (const T& value : *this) {
+            cout << value << " ";
+        }
+        cout << endl;
+    }
+};
+
+// 힙 버퍼 하나만 소유하는 클래스: 주소가 바뀌어도 상관없으므로 memcpy 재배치가 안전하다
+class Buffer {
+private:
+    int* values;
+    size_t length;
+
+public:
+    explicit Buffer(size_t n = 4) : values(new int[n]()), length(n) {}
+    Buffer(const Buffer& other) : values(new int[other.length]), length(other.length) {
+        copy(other.values, other.values + length, values);
+    }
+    Buffer(Buffer&& other) noexcept : values(other.values), length(other.length) {
+        other.values = nullptr;
+        other.length = 0;
+    }
+    ~Buffer() { delete[] values; }
+
+    size_t getLength() const { return length; }
+};
+
+template<>
+struct IsTriviallyRelocatable<Buffer> : true_type {};
+
+// 같은 구조지만 특수화하지 않은 버전 (move_if_noexcept 경로)
+class PlainBuffer {
+private:
+    int* values;
+    size_t length;
+
+public:
+    explicit PlainBuffer(size_t n = 4) : values(new int[n]()), length(n) {}
+    PlainBuffer(const PlainBuffer& other) : values(new int[other.length]), length(other.length) {
+        copy(other.values, other.values + length, values);
+    }
+    PlainBuffer(PlainBuffer&& other) noexcept : values(other.values), length(other.length) {
+        other.values = nullptr;
+        other.length = 0;
+    }
+    ~PlainBuffer() { delete[] values; }
+};
+
+// 이동 생성자가 noexcept가 아닌 타입: 재배치할 때 복사된다
+struct Tracked {
+    static int copies;
+    static int moves;
+    int value;
+
+    Tracked(int v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { copies++; }
+    Tracked(Tracked&& other) : value(other.value) { moves++; }  // noexcept 아님
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+template<typename Vec, typename Make>
+double pushBenchmark(size_t count, Make make, bool reserveFirst) {
+    return measureMs([&] {
+        Vec v;
+        if (reserveFirst) v.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            v.push_back(make(i));
+        }
+        if (v.size() != count) cout << "크기 오류" << endl;
+    });
+}
+
+int main() {
+    cout << "=== 크기가 늘어나는 SimpleVector ===" << endl;
+
+    SimpleVector<int> v1;
+    for (int i = 1; i <= 10; i++) {
+        v1.push_back(i * 10);
+        cout << "size=" << v1.size() << ", capacity=" << v1.capacity() << endl;
+    }
+    v1.display();
+
+    v1.shrink_to_fit();
+    cout << "shrink_to_fit 후 capacity: " << v1.capacity() << endl;
+
+    // 자기 요소를 인자로 넘겨도 안전
+    v1.push_back(v1[0]);
+    cout << "자기 요소 추가: " << v1[v1.size() - 1] << endl;
+
+    cout << "\n=== 복사/이동 대입 ===" << endl;
+    SimpleVector<string> names = {"김철수", "이영희"};
+    names.emplace_back(3, '*');
+    names.resize(names.capacity() + 2, names[0]);  // 재할당이 일어나도 자기 요소로 채울 수 있다
+    cout << "resize 후 마지막 요소: " << names[names.size() - 1] << " (크기 " << names.size() << ")" << endl;
+    names.resize(3);
+    SimpleVector<string> copied;
+    copied = names;             // 복사 대입
+    SimpleVector<string> moved;
+    moved = std::move(names);   // 이동 대입
+    cout << "복사본: ";
+    copied.display();
+    cout << "이동 후 원본 크기: " << names.size() << ", 대상: ";
+    moved.display();
+
+    try {
+        moved.at(10);
+    }
+    catch (const out_of_range& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+
+    cout << "\n=== move_if_noexcept ===" << endl;
+    SimpleVector<Tracked> tracked;
+    for (int i = 0; i < 9; i++) {
+        tracked.emplace_back(i);
+    }
+    cout << "noexcept가 아닌 이동 생성자 → 재배치 시 복사 " << Tracked::copies << "번, 이동 " << Tracked::moves << "번" << endl;
+
+    cout << "\n=== 증가 정책 비교 (1000개 추가 시 재할당 횟수) ===" << endl;
+    auto countReallocations = [](auto& vec) {
+        int reallocations = 0;
+        size_t lastCapacity = vec.capacity();
+        for (int i = 0; i < 1000; i++) {
+            vec.push_back(i);
+            if (vec.capacity() != lastCapacity) {
+                reallocations++;
+                lastCapacity = vec.capacity();
+            }
+        }
+        return reallocations;
+    };
+    SimpleVector<int, DoublingGrowth> doubling;
+    SimpleVector<int, GoldenGrowth> golden;
+    cout << "2배 증가: " << countReallocations(doubling) << "번 (최종 용량 " << doubling.capacity() << ")" << endl;
+    cout << "1.5배 증가: " << countReallocations(golden) << "번 (최종 용량 " << golden.capacity() << ")" << endl;
+
+    cout << "\n=== 벤치마크: push_back (ms) ===" << endl;
+    const size_t intCount = 10000000;
+    const size_t objectCount = 1000000;
+    auto makeInt = [](size_t i) { return static_cast<int>(i); };
+    auto makeString = [](size_t i) { return "name_" + to_string(i) + "_padding_long"; };
+    auto makeBuffer = [](size_t) { return Buffer(4); };
+    auto makePlain = [](size_t) { return PlainBuffer(4); };
+
+    cout << "int " << intCount << "개" << endl;
+    cout << "  std::vector:  " << pushBenchmark<vector<int>>(intCount, makeInt, false) << endl;
+    cout << "  SimpleVector: " << pushBenchmark<SimpleVector<int>>(intCount, makeInt, false) << endl;
+    cout << "  std::vector (reserve):  " << pushBenchmark<vector<int>>(intCount, makeInt, true) << endl;
+    cout << "  SimpleVector (reserve): " << pushBenchmark<SimpleVector<int>>(intCount, makeInt, true) << endl;
+
+    cout << "string " << objectCount << "개" << endl;
+    cout << "  std::vector:  " << pushBenchmark<vector<string>>(objectCount, makeString, false) << endl;
+    cout << "  SimpleVector: " << pushBenchmark<SimpleVector<string>>(objectCount, makeString, false) << endl;
+
+    cout << "힙 버퍼 객체 " << objectCount << "개" << endl;
+    cout << "  std::vector<Buffer>:            " << pushBenchmark<vector<Buffer>>(objectCount, makeBuffer, false) << endl;
+    cout << "  SimpleVector<PlainBuffer> (이동): " << pushBenchmark<SimpleVector<PlainBuffer>>(objectCount, makePlain, false) << endl;
+    cout << "  SimpleVector<Buffer> (memcpy):  " << pushBenchmark<SimpleVector<Buffer>>(objectCount, makeBuffer, false) << endl;
+
+    return 0;
+}
@@ -0,0 +1,426 @@
+/*
+ * 작은 버퍼 최적화 (SBO)
+ * 파일명: 12_small_buffer_optimization.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 12_small_buffer_optimization 12_small_buffer_optimization.cpp
+ * 실행: ./12_small_buffer_optimization (Linux/Mac) 또는 12_small_buffer_optimization.exe (Windows)
+ */
+
+/*
+주제: 작은 버퍼 최적화 (Small Buffer Optimization)
+정의: 객체 안에 작은 고정 크기 버퍼를 두고, 데이터가 그 크기를 넘을 때만 힙을 사용하는 기법.
+      SimpleVector(11_growable_vector.cpp)와 StringHolder(chapter04/08_move_constructor.cpp)는
+      요소가 하나뿐이어도 항상 new[]를 호출한다.
+
+핵심 개념: 인라인 저장소, 힙으로 넘치기(spill), 두 상태에서의 복사/이동
+정의:
+- 인라인 저장소: 템플릿 매개변수로 정한 용량만큼 객체 내부에 공간을 둔다
+- 넘치기: 인라인 용량을 초과하면 그때 처음으로 힙에 할당하고 요소를 옮긴다
+- 이동: 힙 상태는 포인터만 가져오면 되지만, 인라인 상태는 주소가 객체 안에 있으므로
+  요소를 하나씩 이동해야 한다
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+using namespace std;
+
+// 할당 횟수 측정용 전역 operator new 교체
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    if (void* p = malloc(size > 0 ? size : 1)) {
+        return p;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// 인라인 용량 InlineCapacity를 가진 벡터. 그 이하일 때는 힙 할당이 없다
+template<typename T, size_t InlineCapacity = 16>
+class SmallVector {
+private:
+    T* items;
+    size_t itemCount = 0;
+    size_t itemCapacity = InlineCapacity;
+    alignas(T) unsigned char inlineStorage[InlineCapacity * sizeof(T)];
+
+    T* inlineBuffer() { return reinterpret_cast<T*>(inlineStorage); }
+    bool isInline() const { return items == reinterpret_cast<const T*>(inlineStorage); }
+
+    static void destroy(T* first, T* last) {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    // 요소들을 dest로 옮기고 원본은 소멸 (dest는 비어 있는 공간)
+    static void moveElements(T* source, size_t count, T* dest) {
+        if constexpr (is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                memcpy(static_cast<void*>(dest), static_cast<const void*>(source), count * sizeof(T));
+            }
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < count; ++built) {
+                    ::new (static_cast<void*>(dest + built)) T(move_if_noexcept(source[built]));
+                }
+            }
+            catch (...) {
+                destroy(dest, dest + built);
+                throw;
+            }
+            destroy(source, source + count);
+        }
+    }
+
+    void releaseHeap() {
+        if (!isInline()) {
+            ::operator delete(items);
+        }
+    }
+
+    // 새 용량으로 옮긴다. newCapacity가 인라인 용량 이하면 인라인으로 되돌아간다
+    void reallocate(size_t newCapacity) {
+        T* fresh = newCapacity <= InlineCapacity
+                       ? inlineBuffer()
+                       : static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+        if (fresh == items) {
+            return;
+        }
+        try {
+            moveElements(items, itemCount, fresh);
+        }
+        catch (...) {
+            if (fresh != inlineBuffer()) ::operator delete(fresh);
+            throw;
+        }
+        releaseHeap();
+        items = fresh;
+        itemCapacity = max(newCapacity, InlineCapacity);
+    }
+
+    // 다른 객체의 요소를 빈 상태인 *this로 가져온다
+    void stealFrom(SmallVector& other) noexcept(is_nothrow_move_constructible_v<T>) {
+        if (other.isInline()) {
+            // 인라인 상태: 주소를 넘길 수 없으므로 요소를 하나씩 이동
+            moveElements(other.items, other.itemCount, inlineBuffer());
+            itemCount = other.itemCount;
+            other.itemCount = 0;
+        } else {
+            // 힙 상태: 포인터만 넘기고 상대는 빈 인라인 상태로
+            items = other.items;
+            itemCount = other.itemCount;
+            itemCapacity = other.itemCapacity;
+            other.items = other.inlineBuffer();
+            other.itemCount = 0;
+            other.itemCapacity = InlineCapacity;
+        }
+    }
+
+public:
+    SmallVector() : items(inlineBuffer()) {}
+
+    SmallVector(initializer_list<T> init) : SmallVector() {
+        reserve(init.size());
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    SmallVector(const SmallVector& other) : SmallVector() {
+        reserve(other.itemCount);
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    SmallVector(SmallVector&& other) noexcept(is_nothrow_move_constructible_v<T>) : SmallVector() {
+        stealFrom(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            SmallVector copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            releaseHeap();
+            items = inlineBuffer();
+            itemCapacity = InlineCapacity;
+            stealFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        releaseHeap();
+    }
+
+    void reserve(size_t newCapacity) {
+        if (newCapacity > itemCapacity) {
+            reallocate(newCapacity);
+        }
+    }
+
+    // 요소 수가 인라인 용량 이하로 줄었다면 힙을 반납하고 인라인으로 돌아간다
+    void shrink_to_fit() {
+        if (!isInline() && itemCount < itemCapacity) {
+            reallocate(itemCount);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (itemCount == itemCapacity) {
+            // 인자가 자기 요소를 가리킬 수 있으므로 값을 먼저 만든 뒤 넘친다
+            T value(std::forward<Args>(args)...);
+            reallocate(itemCapacity * 2);
+            return *::new (static_cast<void*>(items + itemCount++)) T(std::move(value));
+        }
+        return *::new (static_cast<void*>(items + itemCount++)) T(std::forward<Args>(args)...);
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        if (itemCount == 0) {
+            throw out_of_range("빈 벡터에서 pop_back 호출");
+        }
+        items[--itemCount].~T();
+    }
+
+    void clear() noexcept {
+        destroy(items, items + itemCount);
+        itemCount = 0;
+    }
+
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+
+    T* begin() { return items; }
+    T* end() { return items + itemCount; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + itemCount; }
+
+    size_t size() const { return itemCount; }
+    size_t capacity() const { return itemCapacity; }
+    bool empty() const { return itemCount == 0; }
+    bool usesInlineStorage() const { return isInline(); }
+
+    void display() const {
+        for (const T& value : *this) {
+            cout << value << " ";
+        }
+        cout << (isInline() ? "(인라인)" : "(힙)") << endl;
+    }
+};
+
+// 인라인 버퍼 InlineSize바이트(널 문자 포함)를 가진 문자열 보관 클래스
+template<size_t InlineSize = 24>
+class StringHolder {
+private:
+    char* str;
+    size_t length;
+    char inlineBuffer[InlineSize];
+
+    bool isInline() const { return str == inlineBuffer; }
+
+    void assign(const char* s, size_t len) {
+        length = len;
+        str = len < InlineSize ? inlineBuffer : new char[len + 1];
+        memcpy(str, s, len);
+        str[len] = '\0';
+    }
+
+    void release() {
+        if (str && !isInline()) {
+            delete[] str;
+        }
+        str = nullptr;
+        length = 0;
+    }
+
+    void stealFrom(StringHolder& other) noexcept {
+        if (!other.str) {
+            str = nullptr;
+            length = 0;
+        } else if (other.isInline()) {
+            assign(other.str, other.length);  // 인라인: 내용 복사 (할당 없음)
+            other.release();
+        } else {
+            str = other.str;                  // 힙: 포인터 이동
+            length = other.length;
+            other.str = nullptr;
+            other.length = 0;
+        }
+    }
+
+public:
+    StringHolder(const char* s) {
+        assign(s, strlen(s));
+    }
+
+    StringHolder(const StringHolder& other) : str(nullptr), length(0) {
+        if (other.str) {
+            assign(other.str, other.length);
+        }
+    }
+
+    StringHolder(StringHolder&& other) noexcept {
+        stealFrom(other);
+    }
+
+    StringHolder& operator=(const StringHolder& other) {
+        if (this != &other) {
+            StringHolder copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    StringHolder& operator=(StringHolder&& other) noexcept {
+        if (this != &other) {
+            release();
+            stealFrom(other);
+        }
+        return *this;
+    }
+
+    ~StringHolder() {
+        release();
+    }
+
+    const char* c_str() const { return str ? str : ""; }
+    size_t size() const { return length; }
+    bool usesInlineStorage() const { return str && isInline(); }
+
+    void display() const {
+        cout << (str ? str : "비어있음");
+        if (str) cout << (isInline() ? " (인라인)" : " (힙)");
+        cout << endl;
+    }
+};
+
+template<typename Func>
+size_t countAllocations(Func func) {
+    size_t before = allocationCount;
+    func();
+    return allocationCount - before;
+}
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    cout << "=== SmallVector ===" << endl;
+    SmallVector<int, 4> small = {10, 20, 30};
+    small.display();
+
+    small.push_back(40);
+    small.push_back(50);  // 인라인 용량(4) 초과 → 힙으로 넘침
+    small.display();
+
+    small.pop_back();
+    small.shrink_to_fit();  // 다시 인라인으로
+    small.display();
+
+    cout << "\n=== 두 상태에서의 복사/이동 ===" << endl;
+    SmallVector<string, 2> inlineNames = {"김철수", "이영희"};
+    SmallVector<string, 2> heapNames = {"박민수", "최정화", "홍길동"};
+
+    SmallVector<string, 2> copiedInline = inlineNames;
+    SmallVector<string, 2> movedHeap = std::move(heapNames);
+    cout << "인라인 복사본: ";
+    copiedInline.display();
+    cout << "힙 이동 결과: ";
+    movedHeap.display();
+    cout << "이동 후 원본 크기: " << heapNames.size() << endl;
+
+    copiedInline = movedHeap;               // 인라인 ← 힙 복사
+    movedHeap = std::move(inlineNames);     // 힙 ← 인라인 이동
+    cout << "대입 후: ";
+    copiedInline.display();
+    cout << "대입 후: ";
+    movedHeap.display();
+
+    cout << "\n=== StringHolder ===" << endl;
+    StringHolder<> shortName("Hello");
+    StringHolder<> longName("이 문자열은 24바이트보다 길어서 힙을 사용합니다");
+    shortName.display();
+    longName.display();
+
+    StringHolder<> s2 = std::move(shortName);
+    StringHolder<> s3 = longName;
+    shortName.display();  // 비어있음
+    s2.display();
+    s3.display();
+
+    cout << "\n=== 객체당 할당 횟수 ===" << endl;
+    size_t allocations = countAllocations([] {
+        SmallVector<int> v;
+        for (int i = 0; i < 16; i++) v.push_back(i);
+    });
+    cout << "SmallVector<int> 16개: " << allocations << "번" << endl;
+
+    allocations = countAllocations([] {
+        vector<int> v;
+        for (int i = 0; i < 16; i++) v.push_back(i);
+    });
+    cout << "std::vector<int> 16개: " << allocations << "번" << endl;
+
+    allocations = countAllocations([] {
+        StringHolder<> s("student_name_0001");
+        StringHolder<> copy = s;
+        StringHolder<> moved = std::move(copy);
+    });
+    cout << "StringHolder 생성+복사+이동 (17바이트): " << allocations << "번" << endl;
+
+    cout << "\n=== 벤치마크: 10개짜리 벡터 100만 개 생성 (ms) ===" << endl;
+    const int objectCount = 1000000;
+    long long checksum = 0;
+
+    double stdTime = measureMs([&] {
+        for (int n = 0; n < objectCount; n++) {
+            vector<int> v;
+            for (int i = 0; i < 10; i++) v.push_back(i + n);
+            checksum += v[9];
+        }
+    });
+    double smallTime = measureMs([&] {
+        for (int n = 0; n < objectCount; n++) {
+            SmallVector<int> v;
+            for (int i = 0; i < 10; i++) v.push_back(i + n);
+            checksum += v[9];
+        }
+    });
+    cout << "std::vector: " << stdTime << ", SmallVector: " << smallTime << " (checksum " << checksum << ")" << endl;
+
+    return 0;
+}
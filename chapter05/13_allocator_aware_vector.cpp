@@ -0,0 +1,426 @@
+/*
+ * 할당자를 받는 벡터와 메모리 리소스
+ * 파일명: 13_allocator_aware_vector.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 13_allocator_aware_vector 13_allocator_aware_vector.cpp
+ * 실행: ./13_allocator_aware_vector (Linux/Mac) 또는 13_allocator_aware_vector.exe (Windows)
+ */
+
+/*
+주제: 할당자 인식 컨테이너 (Allocator-aware Container)
+정의: SimpleVector(10_simple_vector.cpp)와 Array(chapter04/07_copy_constructor.cpp)는
+      new int[]와 delete[]를 직접 호출한다. 요소 타입과 할당자를 템플릿 매개변수로 받으면
+      같은 컨테이너를 상황에 맞는 메모리 전략 위에서 사용할 수 있다.
+
+핵심 개념: allocator_traits, std::pmr::memory_resource, 아레나, 풀
+정의:
+- allocator_traits: 할당자의 allocate/construct/destroy 등을 일관된 방식으로 호출하는 도구
+- polymorphic_allocator: 실제 할당을 memory_resource 객체에 위임하는 할당자.
+  컨테이너 타입은 그대로 두고 실행 중에 메모리 전략을 바꿀 수 있다
+- monotonic_buffer_resource(아레나): 해제를 무시하고 앞으로만 잘라 쓰다가 한 번에 버린다.
+  요청 하나를 처리하는 동안만 쓰는 임시 데이터에 알맞다
+- unsynchronized_pool_resource(풀): 크기별로 블록을 모아 재사용한다. 오래 사는 데이터에 알맞다
+- StatisticsResource: 정적 카운터 totalVectors 대신 리소스마다 할당 횟수와 바이트를 센다
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+template<typename T, typename Alloc = allocator<T>>
+class SimpleVector {
+public:
+    using value_type = T;
+    using allocator_type = Alloc;  // uses-allocator 생성(중첩 pmr 컨테이너)에 필요
+
+private:
+    using Traits = allocator_traits<Alloc>;
+
+    Alloc alloc;
+    T* items = nullptr;
+    size_t itemCount = 0;
+    size_t itemCapacity = 0;
+
+    void destroyAll() noexcept {
+        for (size_t i = 0; i < itemCount; i++) {
+            Traits::destroy(alloc, items + i);
+        }
+        if (items) {
+            Traits::deallocate(alloc, items, itemCapacity);
+        }
+        items = nullptr;
+        itemCount = 0;
+        itemCapacity = 0;
+    }
+
+    // 기존 요소들을 fresh로 옮긴다. 예외가 나면 fresh에 만든 것만 정리하고 원본은 유지
+    void relocateTo(T* fresh) {
+        size_t built = 0;
+        try {
+            for (; built < itemCount; ++built) {
+                Traits::construct(alloc, fresh + built, move_if_noexcept(items[built]));
+            }
+        }
+        catch (...) {
+            for (size_t i = 0; i < built; i++) {
+                Traits::destroy(alloc, fresh + i);
+            }
+            throw;
+        }
+    }
+
+    // 옮기기가 끝난 fresh를 새 버퍼로 삼고 기존 버퍼를 정리한다
+    void adopt(T* fresh, size_t newCapacity) noexcept {
+        size_t count = itemCount;
+        destroyAll();
+        items = fresh;
+        itemCount = count;
+        itemCapacity = newCapacity;
+    }
+
+    void reallocate(size_t newCapacity) {
+        T* fresh = Traits::allocate(alloc, newCapacity);
+        try {
+            relocateTo(fresh);
+        }
+        catch (...) {
+            Traits::deallocate(alloc, fresh, newCapacity);
+            throw;
+        }
+        adopt(fresh, newCapacity);
+    }
+
+    // 꽉 찬 상태에서 추가: 새 요소를 새 버퍼에 할당자로 먼저 만든다.
+    // 인자가 자기 요소를 가리켜도 안전하고, 할당자 없이 임시 값을 만들지 않으므로
+    // pmr::string 같은 요소도 기본 리소스가 아니라 이 컨테이너의 리소스를 쓴다
+    template<typename... Args>
+    T& growAndEmplace(Args&&... args) {
+        size_t newCapacity = itemCapacity == 0 ? 4 : itemCapacity * 2;
+        T* fresh = Traits::allocate(alloc, newCapacity);
+        T* slot = fresh + itemCount;
+        try {
+            Traits::construct(alloc, slot, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            Traits::deallocate(alloc, fresh, newCapacity);
+            throw;
+        }
+        try {
+            relocateTo(fresh);
+        }
+        catch (...) {
+            Traits::destroy(alloc, slot);
+            Traits::deallocate(alloc, fresh, newCapacity);
+            throw;
+        }
+        adopt(fresh, newCapacity);
+        ++itemCount;
+        return *slot;
+    }
+
+    // 버퍼만 교환한다. 할당자 교환 여부는 호출하는 쪽에서 propagate_* 규칙에 따라 정한다
+    // (polymorphic_allocator는 대입 연산자가 삭제되어 있다)
+    void swapBuffers(SimpleVector& other) noexcept {
+        swap(items, other.items);
+        swap(itemCount, other.itemCount);
+        swap(itemCapacity, other.itemCapacity);
+    }
+
+public:
+    SimpleVector() = default;
+
+    explicit SimpleVector(const Alloc& a) : alloc(a) {}
+
+    SimpleVector(size_t count, const T& value, const Alloc& a = Alloc()) : alloc(a) {
+        reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            push_back(value);
+        }
+    }
+
+    SimpleVector(initializer_list<T> init, const Alloc& a = Alloc()) : alloc(a) {
+        reserve(init.size());
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    // 복사 생성자: 할당자가 정한 규칙(select_on_container_copy_construction)을 따른다
+    SimpleVector(const SimpleVector& other)
+        : SimpleVector(other, Traits::select_on_container_copy_construction(other.alloc)) {}
+
+    SimpleVector(const SimpleVector& other, const Alloc& a) : alloc(a) {
+        reserve(other.itemCount);
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    // 이동 생성자: 할당자와 버퍼를 함께 가져온다
+    SimpleVector(SimpleVector&& other) noexcept : alloc(std::move(other.alloc)) {
+        swapBuffers(other);
+    }
+
+    // 할당자가 다르면 버퍼를 가져올 수 없으므로 요소를 하나씩 이동한다
+    SimpleVector(SimpleVector&& other, const Alloc& a) : alloc(a) {
+        if (alloc == other.alloc) {
+            swapBuffers(other);
+        } else {
+            reserve(other.itemCount);
+            for (T& value : other) {
+                push_back(std::move(value));
+            }
+            other.clear();
+        }
+    }
+
+    SimpleVector& operator=(const SimpleVector& other) {
+        if (this != &other) {
+            if constexpr (Traits::propagate_on_container_copy_assignment::value) {
+                if (alloc != other.alloc) {
+                    destroyAll();  // 기존 버퍼는 기존 할당자로 해제
+                }
+                alloc = other.alloc;
+            }
+            SimpleVector copy(other, alloc);
+            swapBuffers(copy);
+        }
+        return *this;
+    }
+
+    SimpleVector& operator=(SimpleVector&& other) noexcept(
+        Traits::propagate_on_container_move_assignment::value || Traits::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+        if constexpr (Traits::propagate_on_container_move_assignment::value) {
+            destroyAll();
+            alloc = std::move(other.alloc);
+            swapBuffers(other);
+        } else {
+            if (alloc == other.alloc) {
+                destroyAll();
+                swapBuffers(other);
+            } else {
+                // 리소스가 다르면 버퍼를 가져올 수 없으므로 우리 할당자로 요소를 옮긴다
+                SimpleVector moved(std::move(other), alloc);
+                swapBuffers(moved);
+            }
+        }
+        return *this;
+    }
+
+    ~SimpleVector() {
+        destroyAll();
+    }
+
+    Alloc get_allocator() const { return alloc; }
+
+    void reserve(size_t newCapacity) {
+        if (newCapacity > itemCapacity) {
+            reallocate(newCapacity);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (itemCount == itemCapacity) {
+            return growAndEmplace(std::forward<Args>(args)...);
+        }
+        Traits::construct(alloc, items + itemCount, std::forward<Args>(args)...);
+        return items[itemCount++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void clear() noexcept {
+        for (size_t i = 0; i < itemCount; i++) {
+            Traits::destroy(alloc, items + i);
+        }
+        itemCount = 0;
+    }
+
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+
+    T* begin() { return items; }
+    T* end() { return items + itemCount; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + itemCount; }
+
+    size_t size() const { return itemCount; }
+    size_t capacity() const { return itemCapacity; }
+
+    void display() const {
+        for (const T& value : *this) {
+            cout << value << " ";
+        }
+        cout << endl;
+    }
+};
+
+// 메모리 리소스를 쓰는 버전의 별칭 (std::pmr::vector와 같은 방식)
+namespace pmrx {
+    template<typename T>
+    using SimpleVector = ::SimpleVector<T, pmr::polymorphic_allocator<T>>;
+}
+
+// 상위 리소스로 할당을 넘기면서 횟수와 바이트를 기록하는 리소스
+class StatisticsResource : public pmr::memory_resource {
+private:
+    string name;
+    pmr::memory_resource* upstream;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t bytesInUse = 0;
+    size_t peakBytes = 0;
+    size_t totalBytes = 0;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* p = upstream->allocate(bytes, alignment);
+        allocations++;
+        totalBytes += bytes;
+        bytesInUse += bytes;
+        peakBytes = max(peakBytes, bytesInUse);
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        upstream->deallocate(p, bytes, alignment);
+        deallocations++;
+        bytesInUse -= bytes;
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    StatisticsResource(const string& n, pmr::memory_resource* up = pmr::get_default_resource())
+        : name(n), upstream(up) {}
+
+    size_t getAllocations() const { return allocations; }
+    size_t getBytesInUse() const { return bytesInUse; }
+
+    void report() const {
+        cout << "[" << name << "] 할당 " << allocations << "회, 해제 " << deallocations
+             << "회, 누적 " << totalBytes << "B, 사용 중 " << bytesInUse
+             << "B, 최대 " << peakBytes << "B" << endl;
+    }
+};
+
+// 요청 하나를 처리하는 동안 임시 데이터를 만드는 작업
+template<typename Vec, typename Make>
+long long handleRequest(int requestId, Make make) {
+    Vec scratch = make();
+    for (int i = 0; i < 64; i++) {
+        scratch.push_back(requestId + i);
+    }
+    long long sum = 0;
+    for (int value : scratch) {
+        sum += value;
+    }
+    return sum;
+}
+
+int main() {
+    cout << "=== 기본 할당자 (std::allocator) ===" << endl;
+    // chapter04의 Array(3)과 같은 내용: 1 2 3
+    SimpleVector<int> array = {1, 2, 3};
+    SimpleVector<int> copied = array;
+    array.display();
+    copied.display();
+
+    cout << "\n=== 리소스별 통계 ===" << endl;
+    StatisticsResource heapStats("기본 힙");
+    {
+        pmrx::SimpleVector<int> v(&heapStats);
+        for (int i = 0; i < 100; i++) {
+            v.push_back(i);
+        }
+        heapStats.report();
+    }
+    heapStats.report();  // 소멸 후 사용 중 바이트는 0
+
+    cout << "\n=== 아레나: 요청 단위 임시 데이터 ===" << endl;
+    {
+        char stackBuffer[4096];
+        StatisticsResource upstreamStats("아레나의 상위 리소스");
+        pmr::monotonic_buffer_resource arena(stackBuffer, sizeof(stackBuffer), &upstreamStats);
+        StatisticsResource arenaStats("아레나", &arena);
+
+        pmrx::SimpleVector<int> scratch(&arenaStats);
+        for (int i = 0; i < 200; i++) {
+            scratch.push_back(i);
+        }
+        arenaStats.report();
+        upstreamStats.report();  // 스택 버퍼를 넘친 만큼만 힙에서 가져온다
+    }
+
+    cout << "\n=== 풀: 오래 사는 데이터 ===" << endl;
+    {
+        StatisticsResource upstreamStats("풀의 상위 리소스");
+        pmr::unsynchronized_pool_resource pool(&upstreamStats);
+        StatisticsResource poolStats("풀", &pool);
+
+        // pmr::string 요소도 같은 리소스를 사용한다 (uses-allocator 생성).
+        // 벡터가 늘어날 때도 요소를 할당자 없이 임시로 만들지 않으므로 기본 리소스는 쓰이지 않는다
+        StatisticsResource defaultStats("기본 리소스");
+        pmr::memory_resource* previousDefault = pmr::set_default_resource(&defaultStats);
+        pmrx::SimpleVector<pmr::string> names(&poolStats);
+        for (int i = 0; i < 50; i++) {
+            names.emplace_back("학생_이름_" + to_string(i) + "_긴_문자열로_SSO_초과");
+        }
+        pmr::set_default_resource(previousDefault);
+        cout << "요소 문자열의 리소스 == 풀: "
+             << (names[0].get_allocator().resource() == &poolStats ? "예" : "아니오")
+             << ", 기본 리소스 할당: " << defaultStats.getAllocations() << "회" << endl;
+        poolStats.report();
+        upstreamStats.report();
+    }
+
+    cout << "\n=== 서로 다른 리소스 사이의 이동 ===" << endl;
+    {
+        StatisticsResource a("리소스 A"), b("리소스 B");
+        pmrx::SimpleVector<int> va({1, 2, 3}, &a);
+        pmrx::SimpleVector<int> vb(&b);
+        vb = std::move(va);  // 리소스가 다르므로 요소 단위로 이동, vb는 계속 B를 사용
+        cout << "vb: ";
+        vb.display();
+        cout << "vb의 리소스 == B: " << (vb.get_allocator().resource() == &b ? "예" : "아니오") << endl;
+        a.report();
+        b.report();
+    }
+
+    cout << "\n=== 벤치마크: 요청 20만 건의 임시 벡터 (ms) ===" << endl;
+    const int requestCount = 200000;
+    long long checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < requestCount; r++) {
+        checksum += handleRequest<SimpleVector<int>>(r, [] { return SimpleVector<int>(); });
+    }
+    double heapMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    char buffer[8192];
+    for (int r = 0; r < requestCount; r++) {
+        pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), pmr::null_memory_resource());
+        checksum += handleRequest<pmrx::SimpleVector<int>>(r, [&arena] { return pmrx::SimpleVector<int>(&arena); });
+    }
+    double arenaMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "new/delete: " << heapMs << ", 스택 아레나: " << arenaMs << " (checksum " << checksum << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,510 @@
+/*
+ * SIMD 벡터 연산
+ * 파일명: 14_simd_vector_ops.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 14_simd_vector_ops 14_simd_vector_ops.cpp
+ * 실행: ./14_simd_vector_ops (Linux/Mac) 또는 14_simd_vector_ops.exe (Windows)
+ */
+
+/*
+주제: SIMD 일괄 연산 (SIMD Bulk Operations)
+정의: 한 명령어로 여러 요소를 동시에 처리하는 SIMD 명령어를 사용하여
+      calculateSum, doubleArray(chapter03/10_array_functions.cpp) 같은 배열 루프를 빠르게 한다
+
+핵심 개념: 런타임 디스패치, 넓은 누산기, 이식 가능한 대체 경로
+정의:
+- SSE4.1은 int 4개, AVX2는 int 8개를 한 번에 처리한다
+- 런타임 디스패치: 실행 중인 CPU가 지원하는 명령어를 확인하고 가장 빠른 구현을
+  함수 포인터 테이블에 한 번만 고른다. 컴파일 옵션에 -mavx2를 넣지 않아도 된다
+- 넓은 누산기: int를 int에 더하면 수천만 개 합계에서 오버플로가 나므로
+  64비트(long long)로 넓혀서 더한다
+- dot은 곱을 64비트로 만들어 더하므로 합계가 long long 범위 안이면 정확하다
+- scale/add는 int 범위를 넘으면 2의 보수로 감싸진다(wrap-around). 모든 경로가 같은 결과를 낸다
+*/
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#else
+#define SIMD_X86 0
+#endif
+
+using namespace std;
+
+namespace VectorOps {
+
+    struct MinMax {
+        int min;
+        int max;
+    };
+
+    // 구현 하나를 나타내는 함수 포인터 테이블
+    struct Kernels {
+        const char* name;
+        long long (*sum)(const int*, size_t);
+        MinMax (*minMax)(const int*, size_t);
+        void (*scale)(int*, size_t, int);
+        void (*add)(const int*, const int*, int*, size_t);
+        long long (*dot)(const int*, const int*, size_t);
+        void (*prefixSum)(const int*, long long*, size_t);
+    };
+
+    // ---------- 이식 가능한 스칼라 구현 ----------
+    namespace scalar {
+        long long sum(const int* a, size_t n) {
+            long long total = 0;
+            for (size_t i = 0; i < n; i++) total += a[i];
+            return total;
+        }
+
+        MinMax minMax(const int* a, size_t n) {
+            MinMax r{INT_MAX, INT_MIN};
+            for (size_t i = 0; i < n; i++) {
+                if (a[i] < r.min) r.min = a[i];
+                if (a[i] > r.max) r.max = a[i];
+            }
+            return r;
+        }
+
+        // 부호 없는 정수로 계산하여 SIMD와 같은 wrap-around 결과를 낸다 (부호 있는 오버플로는 UB)
+        void scale(int* a, size_t n, int factor) {
+            for (size_t i = 0; i < n; i++) {
+                a[i] = static_cast<int>(static_cast<uint32_t>(a[i]) * static_cast<uint32_t>(factor));
+            }
+        }
+
+        void add(const int* a, const int* b, int* out, size_t n) {
+            for (size_t i = 0; i < n; i++) {
+                out[i] = static_cast<int>(static_cast<uint32_t>(a[i]) + static_cast<uint32_t>(b[i]));
+            }
+        }
+
+        long long dot(const int* a, const int* b, size_t n) {
+            long long total = 0;
+            for (size_t i = 0; i < n; i++) total += static_cast<long long>(a[i]) * b[i];
+            return total;
+        }
+
+        void prefixSum(const int* a, long long* out, size_t n) {
+            long long running = 0;
+            for (size_t i = 0; i < n; i++) {
+                running += a[i];
+                out[i] = running;
+            }
+        }
+    }
+
+    const Kernels scalarKernels = {
+        "scalar", scalar::sum, scalar::minMax, scalar::scale, scalar::add, scalar::dot, scalar::prefixSum
+    };
+
+#if SIMD_X86
+    // ---------- SSE4.1 (int 4개씩) ----------
+    namespace sse41 {
+        __attribute__((target("sse4.1")))
+        long long sum(const int* a, size_t n) {
+            __m128i acc0 = _mm_setzero_si128(), acc1 = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                acc0 = _mm_add_epi64(acc0, _mm_cvtepi32_epi64(v));                      // 하위 2개
+                acc1 = _mm_add_epi64(acc1, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));   // 상위 2개
+            }
+            __m128i acc = _mm_add_epi64(acc0, acc1);
+            long long lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + scalar::sum(a + i, n - i);
+        }
+
+        __attribute__((target("sse4.1")))
+        MinMax minMax(const int* a, size_t n) {
+            if (n < 4) return scalar::minMax(a, n);
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+            __m128i hi = lo;
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                lo = _mm_min_epi32(lo, v);
+                hi = _mm_max_epi32(hi, v);
+            }
+            int los[4], his[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(los), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(his), hi);
+            MinMax r = scalar::minMax(a + i, n - i);
+            for (int k = 0; k < 4; k++) {
+                r.min = min(r.min, los[k]);
+                r.max = max(r.max, his[k]);
+            }
+            return r;
+        }
+
+        __attribute__((target("sse4.1")))
+        void scale(int* a, size_t n, int factor) {
+            __m128i f = _mm_set1_epi32(factor);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), _mm_mullo_epi32(v, f));
+            }
+            scalar::scale(a + i, n - i, factor);
+        }
+
+        __attribute__((target("sse4.1")))
+        void add(const int* a, const int* b, int* out, size_t n) {
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(x, y));
+            }
+            scalar::add(a + i, b + i, out + i, n - i);
+        }
+
+        __attribute__((target("sse4.1")))
+        long long dot(const int* a, const int* b, size_t n) {
+            __m128i acc = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+                // _mm_mul_epi32는 짝수 번째 요소끼리 곱해 64비트 결과 2개를 만든다
+                acc = _mm_add_epi64(acc, _mm_mul_epi32(x, y));
+                acc = _mm_add_epi64(acc, _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32)));
+            }
+            long long lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + scalar::dot(a + i, b + i, n - i);
+        }
+    }
+
+    const Kernels sse41Kernels = {
+        "sse4.1", sse41::sum, sse41::minMax, sse41::scale, sse41::add, sse41::dot, scalar::prefixSum
+    };
+
+    // ---------- AVX2 (int 8개씩) ----------
+    namespace avx2 {
+        __attribute__((target("avx2")))
+        long long sum(const int* a, size_t n) {
+            __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 4));
+                acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(lo));
+                acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(hi));
+            }
+            long long lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(a + i, n - i);
+        }
+
+        __attribute__((target("avx2")))
+        MinMax minMax(const int* a, size_t n) {
+            if (n < 8) return scalar::minMax(a, n);
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+            __m256i hi = lo;
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                lo = _mm256_min_epi32(lo, v);
+                hi = _mm256_max_epi32(hi, v);
+            }
+            int los[8], his[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(los), lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(his), hi);
+            MinMax r = scalar::minMax(a + i, n - i);
+            for (int k = 0; k < 8; k++) {
+                r.min = min(r.min, los[k]);
+                r.max = max(r.max, his[k]);
+            }
+            return r;
+        }
+
+        __attribute__((target("avx2")))
+        void scale(int* a, size_t n, int factor) {
+            __m256i f = _mm256_set1_epi32(factor);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), _mm256_mullo_epi32(v, f));
+            }
+            scalar::scale(a + i, n - i, factor);
+        }
+
+        __attribute__((target("avx2")))
+        void add(const int* a, const int* b, int* out, size_t n) {
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(x, y));
+            }
+            scalar::add(a + i, b + i, out + i, n - i);
+        }
+
+        __attribute__((target("avx2")))
+        long long dot(const int* a, const int* b, size_t n) {
+            __m256i acc = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                acc = _mm256_add_epi64(acc, _mm256_mul_epi32(x, y));
+                acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)));
+            }
+            long long lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::dot(a + i, b + i, n - i);
+        }
+
+        // 64비트 4개 단위로 레지스터 안에서 누적합을 만든 뒤 앞 블록의 합(carry)을 더한다
+        __attribute__((target("avx2")))
+        void prefixSum(const int* a, long long* out, size_t n) {
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i carry = zero;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+                // [a b c d] + [0 a b c]
+                x = _mm256_add_epi64(x, _mm256_blend_epi32(
+                    _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x03));
+                // + [0 0 a ab]
+                x = _mm256_add_epi64(x, _mm256_blend_epi32(
+                    _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x0F));
+                x = _mm256_add_epi64(x, carry);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+                carry = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+            long long running = i > 0 ? out[i - 1] : 0;
+            for (; i < n; i++) {
+                running += a[i];
+                out[i] = running;
+            }
+        }
+    }
+
+    const Kernels avx2Kernels = {
+        "avx2", avx2::sum, avx2::minMax, avx2::scale, avx2::add, avx2::dot, avx2::prefixSum
+    };
+#endif
+
+    // 사용 가능한 구현 목록 (빠른 것부터)
+    vector<const Kernels*> availableKernels() {
+        vector<const Kernels*> result;
+#if SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) result.push_back(&avx2Kernels);
+        if (__builtin_cpu_supports("sse4.1")) result.push_back(&sse41Kernels);
+#endif
+        result.push_back(&scalarKernels);
+        return result;
+    }
+
+    // 프로그램 전체에서 한 번만 선택
+    const Kernels& active() {
+        static const Kernels* best = availableKernels().front();
+        return *best;
+    }
+
+    // 배열(포인터 + 크기)용 공개 함수
+    inline long long sum(const int* a, size_t n) { return active().sum(a, n); }
+    inline MinMax minMax(const int* a, size_t n) {
+        if (n == 0) throw invalid_argument("빈 배열의 최소/최대값");
+        return active().minMax(a, n);
+    }
+    inline void scale(int* a, size_t n, int factor) { active().scale(a, n, factor); }
+    inline void add(const int* a, const int* b, int* out, size_t n) { active().add(a, b, out, n); }
+    inline long long dot(const int* a, const int* b, size_t n) { return active().dot(a, b, n); }
+    inline void prefixSum(const int* a, long long* out, size_t n) { active().prefixSum(a, out, n); }
+
+} // namespace VectorOps
+
+// 10_simple_vector.cpp의 SimpleVector에 일괄 연산을 추가한 버전
+class SimpleVector {
+private:
+    int* data;
+    size_t size;
+
+public:
+    explicit SimpleVector(size_t s = 0) : data(nullptr), size(s) {
+        if (size > 0) {
+            // 32바이트 정렬: AVX2 로드가 캐시 라인 경계를 덜 넘는다
+            data = static_cast<int*>(::operator new(size * sizeof(int), align_val_t(32)));
+            memset(data, 0, size * sizeof(int));
+        }
+    }
+
+    SimpleVector(const SimpleVector& other) : SimpleVector(other.size) {
+        if (size > 0) memcpy(data, other.data, size * sizeof(int));
+    }
+
+    SimpleVector(SimpleVector&& other) noexcept : data(other.data), size(other.size) {
+        other.data = nullptr;
+        other.size = 0;
+    }
+
+    SimpleVector& operator=(SimpleVector other) noexcept {
+        swap(data, other.data);
+        swap(size, other.size);
+        return *this;
+    }
+
+    ~SimpleVector() {
+        if (data) ::operator delete(data, align_val_t(32));
+    }
+
+    int& operator[](size_t index) { return data[index]; }
+    const int& operator[](size_t index) const { return data[index]; }
+    size_t getSize() const { return size; }
+    int* begin() { return data; }
+    int* end() { return data + size; }
+
+    // 일괄 연산
+    long long sum() const { return VectorOps::sum(data, size); }
+    int min() const { return VectorOps::minMax(data, size).min; }
+    int max() const { return VectorOps::minMax(data, size).max; }
+    void scale(int factor) { VectorOps::scale(data, size, factor); }
+
+    SimpleVector operator+(const SimpleVector& other) const {
+        if (size != other.size) throw invalid_argument("크기가 다른 벡터는 더할 수 없습니다.");
+        SimpleVector result(size);
+        VectorOps::add(data, other.data, result.data, size);
+        return result;
+    }
+
+    long long dot(const SimpleVector& other) const {
+        if (size != other.size) throw invalid_argument("크기가 다른 벡터의 내적");
+        return VectorOps::dot(data, other.data, size);
+    }
+
+    vector<long long> prefixSum() const {
+        vector<long long> result(size);
+        VectorOps::prefixSum(data, result.data(), size);
+        return result;
+    }
+
+    void display() const {
+        for (size_t i = 0; i < size; i++) {
+            cout << data[i] << " ";
+        }
+        cout << endl;
+    }
+};
+
+template<typename Func>
+double measureMs(Func func, int repeat = 5) {
+    double best = 1e30;
+    for (int r = 0; r < repeat; r++) {
+        auto start = chrono::steady_clock::now();
+        func();
+        best = std::min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+// 모든 구현이 스칼라 결과와 같은지 다양한 길이에서 확인
+bool verifyAll(const vector<const VectorOps::Kernels*>& kernels) {
+    mt19937 rng(7);
+    uniform_int_distribution<int> dist(INT_MIN, INT_MAX);
+    uniform_int_distribution<int> small(-65536, 65536);  // 내적 합계가 64비트를 넘지 않는 범위
+    const auto& ref = VectorOps::scalarKernels;
+
+    for (size_t n = 1; n <= 67; n++) {
+        vector<int> a(n), b(n);
+        for (size_t i = 0; i < n; i++) {
+            a[i] = dist(rng);
+            b[i] = small(rng);
+        }
+        for (const auto* k : kernels) {
+            vector<int> s1 = a, s2 = a, o1(n), o2(n);
+            vector<long long> p1(n), p2(n);
+            ref.scale(s1.data(), n, 3);
+            k->scale(s2.data(), n, 3);
+            ref.add(a.data(), b.data(), o1.data(), n);
+            k->add(a.data(), b.data(), o2.data(), n);
+            ref.prefixSum(a.data(), p1.data(), n);
+            k->prefixSum(a.data(), p2.data(), n);
+            auto m1 = ref.minMax(a.data(), n), m2 = k->minMax(a.data(), n);
+
+            if (ref.sum(a.data(), n) != k->sum(a.data(), n) ||
+                ref.dot(a.data(), b.data(), n) != k->dot(a.data(), b.data(), n) ||
+                m1.min != m2.min || m1.max != m2.max || s1 != s2 || o1 != o2 || p1 != p2) {
+                cout << k->name << " 구현 불일치 (n=" << n << ")" << endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    auto kernels = VectorOps::availableKernels();
+    cout << "=== SIMD 벡터 연산 ===" << endl;
+    cout << "선택된 구현: " << VectorOps::active().name << " (사용 가능:";
+    for (const auto* k : kernels) cout << " " << k->name;
+    cout << ")" << endl;
+    cout << "정확성 검사: " << (verifyAll(kernels) ? "모든 구현 일치" : "실패") << endl;
+
+    cout << "\n=== SimpleVector 일괄 연산 ===" << endl;
+    SimpleVector v1(10), v2(10);
+    for (size_t i = 0; i < 10; i++) {
+        v1[i] = static_cast<int>(i + 1);
+        v2[i] = static_cast<int>(10 - i);
+    }
+    cout << "v1: ";
+    v1.display();
+    cout << "v2: ";
+    v2.display();
+    cout << "합계: " << v1.sum() << ", 최소: " << v1.min() << ", 최대: " << v1.max() << endl;
+    cout << "내적: " << v1.dot(v2) << endl;
+    cout << "v1 + v2: ";
+    (v1 + v2).display();
+    cout << "누적합: ";
+    for (long long p : v1.prefixSum()) cout << p << " ";
+    cout << endl;
+    v1.scale(2);  // doubleArray와 같은 작업
+    cout << "2배: ";
+    v1.display();
+
+    cout << "\n=== 오버플로 안전한 합계 ===" << endl;
+    int big[] = {INT_MAX, INT_MAX, INT_MAX};
+    // calculateSum은 int로 누산하므로 이 배열에서 오버플로(정의되지 않은 동작)가 난다
+    cout << "int 최대값: " << INT_MAX << endl;
+    cout << "VectorOps::sum (64비트 누산): " << VectorOps::sum(big, 3) << endl;
+
+    cout << "\n=== 벤치마크: 2천만 개 (ms, 5회 중 최소) ===" << endl;
+    const size_t n = 20000000;
+    vector<int> a(n), b(n), out(n);
+    vector<long long> prefix(n);
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(-1000, 1000);
+    for (size_t i = 0; i < n; i++) {
+        a[i] = dist(rng);
+        b[i] = dist(rng);
+    }
+
+    long long sink = 0;
+    for (const auto* k : kernels) {
+        double sumMs = measureMs([&] { sink += k->sum(a.data(), n); });
+        double minMaxMs = measureMs([&] { sink += k->minMax(a.data(), n).max; });
+        double scaleMs = measureMs([&] { k->scale(out.data(), n, 3); });
+        double addMs = measureMs([&] { k->add(a.data(), b.data(), out.data(), n); });
+        double dotMs = measureMs([&] { sink += k->dot(a.data(), b.data(), n); });
+        double prefixMs = measureMs([&] { k->prefixSum(a.data(), prefix.data(), n); });
+        cout << k->name << ": sum " << sumMs << ", minmax " << minMaxMs << ", scale " << scaleMs
+             << ", add " << addMs << ", dot " << dotMs << ", prefix " << prefixMs << endl;
+    }
+    cout << "(결과 확인용: " << sink << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,307 @@
+/*
+ * 고정 용량 벡터 (constexpr)
+ * 파일명: 10_static_vector.cpp
+ *
+ * 컴파일: g++ -std=c++20 -O2 -o 10_static_vector 10_static_vector.cpp
+ * 실행: ./10_static_vector (Linux/Mac) 또는 10_static_vector.exe (Windows)
+ */
+
+/*
+주제: 고정 용량 벡터 (Fixed-capacity Inline Vector)
+정의: 02_class_template_basic.cpp의 Array<T, SIZE>를 발전시킨 컨테이너.
+      최대 크기는 템플릿 인자로 정하고, 요소는 객체 안에 저장하므로 힙 할당이 전혀 없다.
+
+핵심 개념: 초기화되지 않은 저장소, constexpr 컨테이너, 명확한 오류 처리
+정의:
+- Array는 T data[SIZE]를 가지므로 생성 시점에 SIZE개를 모두 기본 생성한다.
+  StaticVector는 공용체(union)로 저장소만 잡아 두고, 요소는 push_back할 때 생성한다
+- constexpr: std::construct_at/destroy_at(C++20)을 사용하므로 컴파일 시간 계산에서도 쓸 수 있다
+  (이 예제만 -std=c++20이 필요하다)
+- 오류 처리: Array::set은 범위를 벗어나면 조용히 무시했지만, 여기서는 at()과 push_back이
+  예외를 던진다. 예외를 원하지 않는 경로에서는 try_push_back의 반환값을 확인한다
+*/
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+using namespace std;
+
+template<typename T, size_t Capacity>
+class StaticVector {
+private:
+    // 생성자를 호출하지 않는 저장소. 요소의 수명은 count가 관리한다
+    union Storage {
+        constexpr Storage() {}
+        constexpr ~Storage() requires is_trivially_destructible_v<T> = default;
+        constexpr ~Storage() {}
+
+        T items[Capacity];
+    };
+
+    Storage storage;
+    size_t count = 0;
+
+    constexpr T* slot(size_t index) { return &storage.items[index]; }
+
+    constexpr void destroyFrom(size_t first) {
+        for (size_t i = first; i < count; i++) {
+            destroy_at(slot(i));
+        }
+        count = first;
+    }
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr StaticVector() = default;
+
+    constexpr StaticVector(initializer_list<T> init) {
+        if (init.size() > Capacity) {
+            throw length_error("StaticVector 용량 초과");
+        }
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    constexpr StaticVector(const StaticVector& other) {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    constexpr StaticVector(StaticVector&& other) noexcept(is_nothrow_move_constructible_v<T>) {
+        for (T& value : other) {
+            push_back(std::move(value));
+        }
+        other.clear();
+    }
+
+    constexpr StaticVector& operator=(const StaticVector& other) {
+        if (this != &other) {
+            clear();
+            for (const T& value : other) {
+                push_back(value);
+            }
+        }
+        return *this;
+    }
+
+    constexpr StaticVector& operator=(StaticVector&& other) noexcept(is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            for (T& value : other) {
+                push_back(std::move(value));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    // 요소가 자명하게 소멸되면 소멸자도 자명하게 두어 상수 표현식에서 제약이 없도록 한다
+    constexpr ~StaticVector() requires is_trivially_destructible_v<T> = default;
+    constexpr ~StaticVector() { clear(); }
+
+    // 요소 추가
+    template<typename... Args>
+    constexpr T& emplace_back(Args&&... args) {
+        if (count == Capacity) {
+            throw length_error("StaticVector 용량 초과");
+        }
+        T* p = construct_at(slot(count), std::forward<Args>(args)...);
+        ++count;
+        return *p;
+    }
+
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    // 예외 없이 실패를 알려주는 버전 (용량이 다 찼으면 false)
+    constexpr bool try_push_back(const T& value) {
+        if (count == Capacity) return false;
+        construct_at(slot(count), value);
+        ++count;
+        return true;
+    }
+
+    constexpr void pop_back() {
+        if (count == 0) {
+            throw out_of_range("빈 StaticVector에서 pop_back 호출");
+        }
+        destroy_at(slot(--count));
+    }
+
+    // 삭제 후 뒤의 요소들을 앞으로 당긴다. 삭제된 다음 위치를 반환
+    constexpr iterator erase(const_iterator position) {
+        return erase(position, position + 1);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        T* dest = begin() + (first - begin());
+        T* src = begin() + (last - begin());
+        if (dest < begin() || src > end() || dest > src) {
+            throw out_of_range("StaticVector::erase 범위 오류");
+        }
+        T* newEnd = std::move(src, end(), dest);
+        destroyFrom(static_cast<size_t>(newEnd - begin()));
+        return dest;
+    }
+
+    constexpr void clear() { destroyFrom(0); }
+
+    // 요소 접근 (참조 반환: Array::get처럼 값을 복사하지 않는다)
+    constexpr T& operator[](size_t index) { return storage.items[index]; }
+    constexpr const T& operator[](size_t index) const { return storage.items[index]; }
+
+    constexpr T& at(size_t index) {
+        if (index >= count) throw out_of_range("인덱스 범위 초과: " + to_string(index));
+        return storage.items[index];
+    }
+
+    constexpr const T& at(size_t index) const {
+        if (index >= count) throw out_of_range("인덱스 범위 초과: " + to_string(index));
+        return storage.items[index];
+    }
+
+    constexpr T& front() { return at(0); }
+    constexpr T& back() { return at(count - 1); }
+
+    // 반복자
+    constexpr iterator begin() { return storage.items; }
+    constexpr iterator end() { return storage.items + count; }
+    constexpr const_iterator begin() const { return storage.items; }
+    constexpr const_iterator end() const { return storage.items + count; }
+
+    constexpr size_t size() const { return count; }
+    static constexpr size_t capacity() { return Capacity; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr bool full() const { return count == Capacity; }
+
+    void display() const {
+        for (const T& value : *this) {
+            cout << value << " ";
+        }
+        cout << endl;
+    }
+};
+
+// 컴파일 시간에 사용: 소수 목록 만들기
+template<size_t N>
+constexpr StaticVector<int, N> firstPrimes() {
+    StaticVector<int, N> primes;
+    for (int candidate = 2; !primes.full(); candidate++) {
+        bool isPrime = all_of(primes.begin(), primes.end(),
+                              [candidate](int p) { return candidate % p != 0; });
+        if (isPrime) primes.push_back(candidate);
+    }
+    return primes;
+}
+
+constexpr auto PRIMES = firstPrimes<10>();
+static_assert(PRIMES.size() == 10 && PRIMES[9] == 29);
+
+// 컴파일 시간에 string 요소와 erase도 동작하는지 확인
+constexpr size_t totalLengthAfterErase() {
+    StaticVector<string, 4> words = {"zero", "one", "two"};
+    words.erase(words.begin());
+    size_t total = 0;
+    for (const auto& w : words) total += w.size();
+    return total;
+}
+static_assert(totalLengthAfterErase() == 6);
+
+// 기본 생성되는 횟수를 세는 타입
+struct Heavy {
+    static int constructed;
+    string payload;
+
+    Heavy() : payload(64, '.') { constructed++; }
+    Heavy(const string& p) : payload(p) { constructed++; }
+    Heavy(const Heavy& other) : payload(other.payload) { constructed++; }
+};
+int Heavy::constructed = 0;
+
+int main() {
+    cout << "=== StaticVector 기초 ===" << endl;
+    StaticVector<int, 5> numbers;
+    for (int i = 0; i < 5; i++) {
+        numbers.push_back(i * 10);
+    }
+    numbers.display();
+    cout << "size: " << numbers.size() << ", capacity: " << numbers.capacity() << endl;
+
+    numbers.erase(numbers.begin() + 1);  // 10 삭제
+    numbers.display();
+
+    numbers[0] = 99;  // 참조로 직접 수정
+    numbers.display();
+
+    cout << "\n=== 오류 처리 ===" << endl;
+    try {
+        numbers.at(10);
+    }
+    catch (const out_of_range& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+
+    numbers.push_back(40);
+    try {
+        numbers.push_back(50);  // 용량 초과
+    }
+    catch (const length_error& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+    cout << "try_push_back 결과: " << (numbers.try_push_back(60) ? "성공" : "실패 (용량 초과)") << endl;
+
+    cout << "\n=== 컴파일 시간에 만든 소수 목록 ===" << endl;
+    PRIMES.display();
+
+    cout << "\n=== 초기화되지 않은 저장소 ===" << endl;
+    Heavy::constructed = 0;
+    {
+        struct OldArray { Heavy data[100]; } old;  // Array<Heavy, 100>과 같은 방식
+        (void)old;
+    }
+    cout << "T data[100]: 생성자 " << Heavy::constructed << "번 호출" << endl;
+
+    Heavy::constructed = 0;
+    {
+        StaticVector<Heavy, 100> heavy;
+        heavy.emplace_back("하나");
+        heavy.emplace_back("둘");
+    }
+    cout << "StaticVector<Heavy, 100>에 2개 추가: 생성자 " << Heavy::constructed << "번 호출" << endl;
+
+    cout << "\n=== 벤치마크: 작은 목록 100만 번 만들기 (ms) ===" << endl;
+    const int iterations = 1000000;
+    long long checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        vector<int> v;
+        for (int i = 0; i < 12; i++) v.push_back(i + n);
+        checksum += v.back();
+    }
+    double vectorMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        StaticVector<int, 16> v;
+        for (int i = 0; i < 12; i++) v.push_back(i + n);
+        checksum += v.back();
+    }
+    double staticMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "std::vector: " << vectorMs << ", StaticVector: " << staticMs << " (checksum " << checksum << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+ * 복사 없는 Box<T>
+ * 파일명: 11_box_zero_copy.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 11_box_zero_copy 11_box_zero_copy.cpp
+ * 실행: ./11_box_zero_copy (Linux/Mac) 또는 11_box_zero_copy.exe (Windows)
+ */
+
+/*
+주제: 복사 없는 접근과 제자리 생성 (Zero-copy Access & In-place Construction)
+정의: 02_class_template_basic.cpp의 Box<T>는 생성자와 setItem이 T를 값으로 받고,
+      getItem()이 복사본을 반환한다. Box<string>이나 큰 데이터를 담으면 접근할 때마다 복사된다.
+
+핵심 개념: 참조 반환, 참조 한정자(&, &&), 제자리 생성(in_place), 이동 인식 setter
+정의:
+- 참조 반환: getItem()이 const T& 또는 T&를 반환하여 복사 없이 읽고 쓴다
+- 참조 한정자: 임시 Box에서 꺼낼 때(getItem() &&)는 T&&를 반환하여 이동할 수 있게 한다
+- 제자리 생성: Box(in_place, args...)와 emplace(args...)는 T의 생성자 인자를 받아
+  Box 안에서 바로 만든다. 임시 T를 만든 뒤 옮기는 단계가 없다
+- 오버헤드 없음: Box<T>의 크기는 T와 같고, 모든 함수가 인라인되어 T를 직접 쓰는 것과 같은 코드가 된다
+*/
+
+#include <iostream>
+#include <string>
+#include <array>
+#include <utility>
+#include <type_traits>
+#include <new>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// 원래 Box (비교용)
+template<typename T>
+class CopyingBox {
+private:
+    T item;
+
+public:
+    CopyingBox(T i) : item(i) {}
+    void setItem(T i) { item = i; }
+    T getItem() { return item; }
+};
+
+template<typename T>
+class Box {
+private:
+    T item;
+
+public:
+    // 값 전달 대신 복사/이동 생성자를 각각 제공
+    Box(const T& i) : item(i) {}
+    Box(T&& i) noexcept(is_nothrow_move_constructible_v<T>) : item(std::move(i)) {}
+
+    // 제자리 생성: T의 생성자 인자를 그대로 전달
+    template<typename... Args>
+    explicit Box(in_place_t, Args&&... args) : item(std::forward<Args>(args)...) {}
+
+    // 이동 인식 setter
+    void setItem(const T& i) { item = i; }
+    void setItem(T&& i) noexcept(is_nothrow_move_assignable_v<T>) { item = std::move(i); }
+
+    // 인자가 item 또는 그 멤버를 가리키는지 (box.emplace(box->second, box->first) 같은 경우)
+    template<typename Arg>
+    bool pointsIntoItem(const Arg& arg) const noexcept {
+        auto address = reinterpret_cast<uintptr_t>(addressof(arg));
+        auto begin = reinterpret_cast<uintptr_t>(addressof(item));
+        return address >= begin && address < begin + sizeof(T);
+    }
+
+    // 기존 값을 버리고 새 값을 그 자리에서 만든다.
+    // item이 소유한 힙 데이터(c_str(), string_view 등)를 인자로 넘기는 것은 허용하지 않는다
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if constexpr (is_nothrow_constructible_v<T, Args...>) {
+            if (!(pointsIntoItem(args) || ...)) {
+                item.~T();
+                ::new (static_cast<void*>(&item)) T(std::forward<Args>(args)...);
+                return item;
+            }
+        }
+        // 생성 중 예외가 나면 item이 소멸된 상태로 남고, 인자가 item을 가리키면 소멸된 값을 읽게 되므로
+        // 먼저 만든 뒤 이동 대입한다
+        item = T(std::forward<Args>(args)...);
+        return item;
+    }
+
+    // 참조 반환 접근자
+    T& getItem() & { return item; }
+    const T& getItem() const& { return item; }
+    T&& getItem() && { return std::move(item); }
+
+    T& operator*() { return item; }
+    const T& operator*() const { return item; }
+    T* operator->() { return &item; }
+    const T* operator->() const { return &item; }
+
+    void display() const {
+        cout << "Box contains: " << item << endl;
+    }
+};
+
+// 크기 오버헤드가 없는지 컴파일 시간에 확인
+static_assert(sizeof(Box<int>) == sizeof(int));
+static_assert(sizeof(Box<string>) == sizeof(string));
+static_assert(sizeof(Box<array<char, 4096>>) == 4096);
+
+// 복사/이동 횟수를 세는 타입
+struct Tracked {
+    static int copies;
+    static int moves;
+    string value;
+
+    Tracked(const char* v) : value(v) {}
+    Tracked(int count, char c) : value(count, c) {}
+    Tracked(const Tracked& other) : value(other.value) { copies++; }
+    Tracked(Tracked&& other) noexcept : value(std::move(other.value)) { moves++; }
+    Tracked& operator=(const Tracked& other) { value = other.value; copies++; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = std::move(other.value); moves++; return *this; }
+
+    static void reset() { copies = moves = 0; }
+    static void report(const string& label) {
+        cout << label << ": 복사 " << copies << "번, 이동 " << moves << "번" << endl;
+    }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+// 컴파일러가 측정 대상 코드를 지우지 못하도록 하는 장벽 (GCC/Clang)
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// 3번 측정한 것 중 가장 빠른 값 (첫 측정의 캐시 준비 비용 제외)
+template<typename Func>
+double nsPerCall(Func func, int iterations) {
+    double best = 1e30;
+    for (int round = 0; round < 3; round++) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            func();
+        }
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / iterations;
+        best = min(best, ns);
+    }
+    return best;
+}
+
+int main() {
+    cout << "=== 기본 사용 (02_class_template_basic.cpp와 동일) ===" << endl;
+    Box<int> intBox(42);
+    Box<string> stringBox("Hello");
+    Box<double> doubleBox(3.14);
+    intBox.display();
+    stringBox.display();
+    doubleBox.display();
+
+    cout << "\n=== 복사/이동 횟수 비교 ===" << endl;
+    Tracked::reset();
+    {
+        CopyingBox<Tracked> box(Tracked("데이터"));
+        box.setItem(Tracked("새 데이터"));
+        for (int i = 0; i < 3; i++) {
+            doNotOptimize(box.getItem().value.size());
+        }
+    }
+    Tracked::report("원래 Box (생성+설정+읽기 3번)");
+
+    Tracked::reset();
+    {
+        Box<Tracked> box(in_place, "데이터");   // 제자리 생성
+        box.setItem(Tracked("새 데이터"));       // 이동
+        box.emplace(10, '*');                   // 제자리 재생성
+        for (int i = 0; i < 3; i++) {
+            doNotOptimize(box.getItem().value.size());  // 참조로 읽기
+        }
+        Tracked taken = std::move(box).getItem();  // 임시 Box에서 꺼내면 이동
+        doNotOptimize(taken);
+    }
+    Tracked::report("새 Box (생성+설정+재생성+읽기 3번+꺼내기)");
+
+    cout << "\n=== 자기 멤버로 재생성 ===" << endl;
+    Box<pair<int, int>> point(in_place, 1, 2);
+    point.emplace(point->second, point->first);  // 인자가 item을 가리키므로 임시 값을 거친다
+    cout << "뒤바꾼 좌표: (" << point->first << ", " << point->second << ")" << endl;
+
+    cout << "\n=== 참조로 직접 수정 ===" << endl;
+    stringBox.getItem() += ", World";
+    stringBox->append("!");
+    stringBox.display();
+
+    cout << "\n=== 마이크로벤치마크: 읽기 1회당 ns (-O2) ===" << endl;
+    const int iterations = 2000000;
+    const string longText(100, 'x');  // SSO를 넘는 문자열
+
+    string bareString = longText;
+    Box<string> newStringBox(longText);
+    CopyingBox<string> oldStringBox(longText);
+    cout << "string   - T 직접: " << nsPerCall([&] { doNotOptimize(bareString.size()); }, iterations)
+         << ", Box: " << nsPerCall([&] { doNotOptimize(newStringBox.getItem().size()); }, iterations)
+         << ", 원래 Box: " << nsPerCall([&] { doNotOptimize(oldStringBox.getItem().size()); }, iterations)
+         << endl;
+
+    using Payload = array<char, 4096>;
+    static Payload barePayload{};
+    static Box<Payload> newPayloadBox(in_place);
+    static CopyingBox<Payload> oldPayloadBox(Payload{});
+    const int payloadIterations = 200000;
+    cout << "4KB 배열 - T 직접: " << nsPerCall([&] { doNotOptimize(barePayload[100]); }, payloadIterations)
+         << ", Box: " << nsPerCall([&] { doNotOptimize(newPayloadBox.getItem()[100]); }, payloadIterations)
+         << ", 원래 Box: " << nsPerCall([&] { doNotOptimize(oldPayloadBox.getItem()[100]); }, payloadIterations)
+         << endl;
+
+    cout << "\nsizeof(Box<string>) == sizeof(string): " << (sizeof(Box<string>) == sizeof(string) ? "예" : "아니오") << endl;
+
+    return 0;
+}
@@ -0,0 +1,490 @@
+/*
+ * 개방 주소법 해시 맵
+ * 파일명: 12_flat_hash_map.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 12_flat_hash_map 12_flat_hash_map.cpp
+ * 실행: ./12_flat_hash_map (Linux/Mac) 또는 12_flat_hash_map.exe (Windows)
+ */
+
+/*
+주제: 개방 주소법 해시 맵 (Open-addressing Hash Map)
+정의: 05_list_map_basic.cpp의 map<string, int> scores는 레드-블랙 트리이므로 검색이 O(log n)이고
+      노드마다 따로 할당된다. 또 find()로 확인한 뒤 operator[]로 다시 찾아 두 번 검색한다.
+      FlatHashMap은 모든 항목을 하나의 배열에 두고, SwissTable 방식으로 16칸씩 묶어 검색한다.
+
+핵심 개념: 제어 바이트, 그룹 검색, 이질적 검색(heterogeneous lookup), 한 번의 탐색
+정의:
+- 제어 바이트: 칸마다 1바이트로 "비어 있음/삭제됨/사용 중 + 해시 7비트"를 기록한다.
+  키를 비교하기 전에 이 바이트만 보고 후보를 거른다
+- 그룹 검색: SSE2 명령어로 제어 바이트 16개를 한 번에 비교한다 (지원하지 않으면 반복문)
+- 이질적 검색: find("이영희")나 find(string_view)가 임시 string을 만들지 않는다
+- try_emplace/find: 한 번의 탐색으로 "찾거나 삽입"을 끝낸다
+*/
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <memory>
+#include <new>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+// string, string_view, const char*를 같은 해시값으로 처리하는 해시 함수
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(string_view s) const { return hash<string_view>{}(s); }
+};
+
+template<typename K>
+struct DefaultHash : hash<K> {};
+
+template<>
+struct DefaultHash<string> : StringHash {};
+
+template<typename K, typename V, typename Hash = DefaultHash<K>, typename Eq = equal_to<>>
+class FlatHashMap {
+public:
+    using value_type = pair<const K, V>;
+
+private:
+    static constexpr size_t GROUP_WIDTH = 16;
+
+    // 제어 바이트: 음수는 빈 칸/삭제된 칸, 0~127은 사용 중인 칸의 해시 7비트(H2)
+    static constexpr int8_t EMPTY = -128;
+    static constexpr int8_t DELETED = -2;
+
+    // 바깥에는 pair<const K, V>로 보이지만, 재배치할 때는 키도 이동할 수 있도록
+    // pair<K, V>로 접근한다 (Abseil 등에서 쓰는 방식)
+    union Slot {
+        value_type value;
+        pair<K, V> mutableValue;
+        Slot() {}
+        ~Slot() {}
+    };
+
+    unique_ptr<int8_t[]> control;
+    Slot* slots = nullptr;
+    size_t capacity = 0;       // 칸 수 (GROUP_WIDTH의 2의 거듭제곱 배)
+    size_t itemCount = 0;
+    size_t growthLeft = 0;     // 재해시 전까지 더 채울 수 있는 칸 수 (삭제된 칸 포함 계산)
+    Hash hasher;
+    Eq equal;
+
+    // 비트마스크의 1인 위치를 차례로 돌려주는 도우미
+    struct BitMask {
+        uint32_t bits;
+        explicit operator bool() const { return bits != 0; }
+        unsigned lowest() const { return static_cast<unsigned>(__builtin_ctz(bits)); }
+        void clearLowest() { bits &= bits - 1; }
+    };
+
+    // 제어 바이트 16개 묶음
+    struct Group {
+#if defined(__SSE2__)
+        __m128i ctrl;
+        explicit Group(const int8_t* p) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+        BitMask match(int8_t h2) const {
+            return {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))))};
+        }
+        BitMask matchEmpty() const { return match(EMPTY); }
+        BitMask matchEmptyOrDeleted() const {
+            return {static_cast<uint32_t>(_mm_movemask_epi8(ctrl))};  // 음수(최상위 비트 1)인 칸
+        }
+#else
+        const int8_t* ctrl;
+        explicit Group(const int8_t* p) : ctrl(p) {}
+
+        BitMask match(int8_t h2) const {
+            uint32_t bits = 0;
+            for (unsigned i = 0; i < GROUP_WIDTH; i++) {
+                if (ctrl[i] == h2) bits |= 1u << i;
+            }
+            return {bits};
+        }
+        BitMask matchEmpty() const { return match(EMPTY); }
+        BitMask matchEmptyOrDeleted() const {
+            uint32_t bits = 0;
+            for (unsigned i = 0; i < GROUP_WIDTH; i++) {
+                if (ctrl[i] < 0) bits |= 1u << i;
+            }
+            return {bits};
+        }
+#endif
+    };
+
+    // 해시를 섞어 상위 7비트는 H2(제어 바이트), 하위 비트는 그룹 위치(H1)로 사용.
+    // std::hash<int>는 항등 함수라서 곱셈 한 번으로는 i << 20 같은 키의 하위 비트가
+    // 모두 0으로 남는다. MurmurHash3의 최종 섞기(fmix64)로 모든 입력 비트를 퍼뜨린다
+    static uint64_t mix(size_t h) {
+        uint64_t x = static_cast<uint64_t>(h);
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDull;
+        x ^= x >> 33;
+        x *= 0xC4CEB9FE1A85EC53ull;
+        x ^= x >> 33;
+        return x;
+    }
+    static int8_t h2Of(uint64_t h) { return static_cast<int8_t>(h >> 57); }
+    size_t groupCount() const { return capacity / GROUP_WIDTH; }
+
+    // 그룹 단위 삼각수 탐사: 그룹 수가 2의 거듭제곱이면 모든 그룹을 한 번씩 방문한다
+    struct ProbeSequence {
+        size_t group;
+        size_t mask;
+        size_t step = 0;
+        size_t offset() const { return group * GROUP_WIDTH; }
+        void next() {
+            step++;
+            group = (group + step) & mask;
+        }
+    };
+
+    ProbeSequence probe(uint64_t h) const {
+        return ProbeSequence{static_cast<size_t>(h) & (groupCount() - 1), groupCount() - 1};
+    }
+
+    static size_t maxLoad(size_t cap) { return cap - cap / 8; }  // 최대 적재율 7/8
+
+    // 키를 찾으면 그 칸 번호, 없으면 capacity
+    template<typename KeyLike>
+    size_t findIndex(const KeyLike& key, uint64_t h) const {
+        if (capacity == 0) return capacity;
+        int8_t h2 = h2Of(h);
+        for (ProbeSequence seq = probe(h);; seq.next()) {
+            Group g(control.get() + seq.offset());
+            for (BitMask m = g.match(h2); m; m.clearLowest()) {
+                size_t index = seq.offset() + m.lowest();
+                if (equal(slots[index].value.first, key)) {
+                    return index;
+                }
+            }
+            // 빈 칸이 있는 그룹까지 왔다면 키는 더 뒤에 있을 수 없다
+            if (g.matchEmpty()) {
+                return capacity;
+            }
+        }
+    }
+
+    // 새 키를 넣을 칸: 탐사 순서에서 처음 만나는 빈 칸 또는 삭제된 칸
+    size_t findInsertSlot(uint64_t h) const {
+        for (ProbeSequence seq = probe(h);; seq.next()) {
+            BitMask m = Group(control.get() + seq.offset()).matchEmptyOrDeleted();
+            if (m) {
+                return seq.offset() + m.lowest();
+            }
+        }
+    }
+
+    void rehash(size_t newCapacity) {
+        unique_ptr<int8_t[]> oldControl = std::move(control);
+        Slot* oldSlots = slots;
+        size_t oldCapacity = capacity;
+
+        control.reset(new int8_t[newCapacity]);
+        memset(control.get(), EMPTY, newCapacity);
+        slots = static_cast<Slot*>(::operator new(newCapacity * sizeof(Slot)));
+        capacity = newCapacity;
+        growthLeft = maxLoad(newCapacity) - itemCount;
+
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (oldControl[i] >= 0) {
+                uint64_t h = mix(hasher(oldSlots[i].value.first));
+                size_t index = findInsertSlot(h);
+                control[index] = h2Of(h);
+                ::new (static_cast<void*>(&slots[index].mutableValue)) pair<K, V>(std::move(oldSlots[i].mutableValue));
+                oldSlots[i].value.~value_type();
+            }
+        }
+        ::operator delete(oldSlots);
+    }
+
+    void growIfNeeded() {
+        if (growthLeft > 0) return;
+        // 삭제된 칸이 많으면 같은 크기로 다시 정리, 아니면 두 배로
+        size_t newCapacity = capacity == 0 ? GROUP_WIDTH
+                           : (itemCount * 32 < capacity * 25 ? capacity : capacity * 2);
+        rehash(newCapacity);
+    }
+
+public:
+    // 반복자: 사용 중인 칸만 차례로 방문 (배열을 순서대로 훑으므로 캐시 친화적)
+    template<bool IsConst>
+    class Iterator {
+    private:
+        using MapPtr = conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+        MapPtr map;
+        size_t index;
+
+        void skipEmpty() {
+            while (index < map->capacity && map->control[index] < 0) index++;
+        }
+
+    public:
+        using reference = conditional_t<IsConst, const value_type&, value_type&>;
+        using pointer = conditional_t<IsConst, const value_type*, value_type*>;
+
+        Iterator(MapPtr m, size_t i) : map(m), index(i) { skipEmpty(); }
+        operator Iterator<true>() const { return Iterator<true>(map, index); }
+
+        reference operator*() const { return map->slots[index].value; }
+        pointer operator->() const { return &map->slots[index].value; }
+        Iterator& operator++() {
+            index++;
+            skipEmpty();
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : control(std::move(other.control)), slots(other.slots), capacity(other.capacity),
+          itemCount(other.itemCount), growthLeft(other.growthLeft) {
+        other.slots = nullptr;
+        other.capacity = other.itemCount = other.growthLeft = 0;
+    }
+
+    ~FlatHashMap() {
+        clear();
+        ::operator delete(slots);
+    }
+
+    // n개를 재해시 없이 넣을 수 있도록 미리 확보
+    void reserve(size_t n) {
+        size_t needed = GROUP_WIDTH;
+        while (maxLoad(needed) < n) needed *= 2;
+        if (needed > capacity) rehash(needed);
+    }
+
+    // 한 번의 탐색으로 찾거나 삽입. 이미 있으면 args는 사용하지 않는다
+    template<typename KeyLike, typename... Args>
+    pair<iterator, bool> try_emplace(KeyLike&& key, Args&&... args) {
+        uint64_t h = mix(hasher(key));
+        size_t found = findIndex(key, h);
+        if (found != capacity) {
+            return {iterator(this, found), false};
+        }
+        growIfNeeded();
+        size_t index = findInsertSlot(h);
+        ::new (static_cast<void*>(&slots[index].value))
+            value_type(piecewise_construct, forward_as_tuple(K(std::forward<KeyLike>(key))),
+                       forward_as_tuple(std::forward<Args>(args)...));
+        if (control[index] == EMPTY) growthLeft--;  // 삭제된 칸을 재사용하면 여유는 그대로
+        control[index] = h2Of(h);
+        itemCount++;
+        return {iterator(this, index), true};
+    }
+
+    template<typename KeyLike>
+    iterator find(const KeyLike& key) {
+        return iterator(this, findIndex(key, mix(hasher(key))));
+    }
+
+    template<typename KeyLike>
+    const_iterator find(const KeyLike& key) const {
+        return const_iterator(this, findIndex(key, mix(hasher(key))));
+    }
+
+    // 값 포인터를 돌려주는 간단한 검색 (없으면 nullptr)
+    template<typename KeyLike>
+    V* findValue(const KeyLike& key) {
+        size_t index = findIndex(key, mix(hasher(key)));
+        return index == capacity ? nullptr : &slots[index].value.second;
+    }
+
+    template<typename KeyLike>
+    bool contains(const KeyLike& key) const {
+        return findIndex(key, mix(hasher(key))) != capacity;
+    }
+
+    template<typename KeyLike>
+    V& operator[](KeyLike&& key) {
+        return try_emplace(std::forward<KeyLike>(key)).first->second;
+    }
+
+    template<typename KeyLike>
+    V& at(const KeyLike& key) {
+        V* value = findValue(key);
+        if (!value) throw out_of_range("키를 찾을 수 없습니다");
+        return *value;
+    }
+
+    template<typename KeyLike>
+    bool erase(const KeyLike& key) {
+        size_t index = findIndex(key, mix(hasher(key)));
+        if (index == capacity) return false;
+
+        slots[index].value.~value_type();
+        itemCount--;
+        // 이 그룹에 이미 빈 칸이 있다면 그룹이 가득 찬 적이 없으므로 이 그룹을 지나쳐
+        // 더 멀리 들어간 키도 없다. 그러면 바로 빈 칸으로 되돌릴 수 있다
+        size_t groupStart = index / GROUP_WIDTH * GROUP_WIDTH;
+        if (Group(control.get() + groupStart).matchEmpty()) {
+            control[index] = EMPTY;
+            growthLeft++;
+        } else {
+            control[index] = DELETED;
+        }
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < capacity; i++) {
+            if (control[i] >= 0) {
+                slots[i].value.~value_type();
+                control[i] = EMPTY;
+            }
+        }
+        itemCount = 0;
+        growthLeft = capacity > 0 ? maxLoad(capacity) : 0;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity); }
+
+    size_t size() const { return itemCount; }
+    bool empty() const { return itemCount == 0; }
+    size_t bucketCount() const { return capacity; }
+};
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 세 가지 맵에 대해 같은 작업을 측정
+template<typename Map, typename Insert, typename Lookup>
+void benchmark(const string& name, const vector<string>& keys, const vector<string>& missing,
+               Insert insert, Lookup lookup) {
+    Map map;
+    long long sink = 0;
+    double insertMs = measureMs([&] {
+        for (size_t i = 0; i < keys.size(); i++) insert(map, keys[i], static_cast<int>(i));
+    });
+    double hitMs = measureMs([&] {
+        for (const auto& key : keys) sink += lookup(map, key);
+    });
+    double missMs = measureMs([&] {
+        for (const auto& key : missing) sink += lookup(map, key);
+    });
+    double iterateMs = measureMs([&] {
+        for (const auto& entry : map) sink += entry.second;
+    });
+    cout << name << ": 삽입 " << insertMs << ", 성공 검색 " << hitMs << ", 실패 검색 " << missMs
+         << ", 순회 " << iterateMs << " (확인용 " << sink << ")" << endl;
+}
+
+int main() {
+    cout << "=== FlatHashMap 기초 (05_list_map_basic.cpp와 같은 작업) ===" << endl;
+    FlatHashMap<string, int> scores;
+    scores["김철수"] = 90;
+    scores["이영희"] = 95;
+    scores["박민수"] = 88;
+    scores.try_emplace("최정화", 92);
+
+    cout << "학생 점수 (해시 순서):" << endl;
+    for (const auto& entry : scores) {
+        cout << entry.first << ": " << entry.second << "점" << endl;
+    }
+
+    // 한 번의 탐색: find로 얻은 포인터를 그대로 사용 (map은 find + operator[]로 두 번 검색)
+    string_view name = "이영희";  // string을 만들지 않고 검색
+    if (int* score = scores.findValue(name)) {
+        cout << "\n" << name << "의 점수: " << *score << "점" << endl;
+    }
+
+    cout << "박민수 등록됨? " << (scores.contains("박민수") ? "예" : "아니오") << endl;
+    cout << "홍길동 등록됨? " << (scores.contains("홍길동") ? "예" : "아니오") << endl;
+
+    auto [it, inserted] = scores.try_emplace("김철수", 0);
+    cout << "김철수 다시 삽입: " << (inserted ? "삽입됨" : "이미 있음, 기존 값 " + to_string(it->second)) << endl;
+
+    scores.erase("박민수");
+    cout << "박민수 삭제 후 크기: " << scores.size() << endl;
+
+    cout << "\n=== 많은 삽입/삭제 후 정확성 확인 ===" << endl;
+    {
+        FlatHashMap<int, int> check;
+        unordered_map<int, int> reference;
+        mt19937 rng(1);
+        for (int step = 0; step < 200000; step++) {
+            int key = static_cast<int>(rng() % 5000);
+            if (rng() % 3 == 0) {
+                check.erase(key);
+                reference.erase(key);
+            } else {
+                check[key] = step;
+                reference[key] = step;
+            }
+        }
+        bool same = check.size() == reference.size();
+        for (const auto& [key, value] : reference) {
+            const int* v = check.findValue(key);
+            same = same && v && *v == value;
+        }
+        cout << "unordered_map과 결과 일치: " << (same ? "예" : "아니오") << " (" << check.size() << "개)" << endl;
+    }
+
+    cout << "\n=== 하위 비트가 0인 정수 키 (i << 20, 20만 개) ===" << endl;
+    {
+        FlatHashMap<size_t, int> shifted;
+        long long found = 0;
+        double ms = measureMs([&] {
+            for (size_t i = 0; i < 200000; i++) shifted[i << 20] = 1;
+            for (size_t i = 0; i < 200000; i++) found += shifted.contains(i << 20);
+        });
+        cout << "삽입 + 검색 " << ms << " ms (찾은 키 " << found << "개)" << endl;
+    }
+
+    cout << "\n=== 벤치마크: 키 100만 개 (ms) ===" << endl;
+    const size_t count = 1000000;
+    vector<string> keys, missing;
+    keys.reserve(count);
+    missing.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        keys.push_back("student_" + to_string(i * 7919));
+        missing.push_back("nobody_" + to_string(i));
+    }
+    shuffle(keys.begin(), keys.end(), mt19937(3));
+
+    // 기존 코드 방식: find로 확인 후 operator[]로 다시 검색
+    benchmark<map<string, int>>("std::map          ", keys, missing,
+        [](auto& m, const string& k, int v) { m[k] = v; },
+        [](auto& m, const string& k) { return m.find(k) != m.end() ? m[k] : 0; });
+    benchmark<unordered_map<string, int>>("std::unordered_map", keys, missing,
+        [](auto& m, const string& k, int v) { m[k] = v; },
+        [](auto& m, const string& k) { auto it = m.find(k); return it != m.end() ? it->second : 0; });
+    benchmark<FlatHashMap<string, int>>("FlatHashMap       ", keys, missing,
+        [](auto& m, const string& k, int v) { m.try_emplace(k, v); },
+        [](auto& m, const string& k) { int* v = m.findValue(k); return v ? *v : 0; });
+
+    return 0;
+}
@@ -0,0 +1,463 @@
+/*
+ * 링 버퍼 덱
+ * 파일명: 14_ring_deque.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 14_ring_deque 14_ring_deque.cpp
+ * 실행: ./14_ring_deque (Linux/Mac) 또는 14_ring_deque.exe (Windows)
+ */
+
+/*
+주제: 링 버퍼 덱 (Ring Buffer Deque)
+정의: 05_list_map_basic.cpp의 todoList는 list<string>으로 push_front/push_back/pop_front를 한다.
+      list는 항목마다 노드를 할당하고 노드가 메모리 곳곳에 흩어져 있다.
+      RingDeque는 하나의 배열을 원형으로 사용하여 양쪽 끝에서 O(1)로 넣고 뺀다.
+
+핵심 개념: 원형 인덱스, 분할 상환 O(1), 연속 구간, 용량 제한과 배압(backpressure)
+정의:
+- 원형 인덱스: 용량을 2의 거듭제곱으로 두고 (head + i) & (capacity - 1)로 위치를 계산한다
+- 분할 상환 O(1): 가득 차면 두 배로 늘리며, 요소를 새 배열 앞쪽으로 펴서 옮긴다
+- 연속 구간: 내용은 최대 두 개의 연속 구간 [head, 끝)과 [0, tail)로 나뉜다.
+  segments()로 두 구간을 받아 포인터로 순회하면 인덱스 계산 없이 훑을 수 있다
+- 용량 제한: 최대 크기를 정하면 더 늘리지 않고 try_push_*가 false를 돌려준다.
+  BlockingQueue는 이를 이용해 가득 차면 생산자를 기다리게 한다 (배압)
+*/
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <new>
+#include <memory>
+#include <type_traits>
+#include <stdexcept>
+#include <limits>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+using namespace std;
+
+template<typename T>
+class RingDeque {
+private:
+    T* data = nullptr;
+    size_t capacityValue = 0;   // 0 또는 2의 거듭제곱
+    size_t head = 0;            // 첫 요소의 위치
+    size_t count = 0;
+    size_t maxSize;             // 용량 제한 (없으면 size_t 최대값)
+
+    size_t mask() const { return capacityValue - 1; }
+    size_t physical(size_t logical) const { return (head + logical) & mask(); }
+
+    // size_t로 나타낼 수 있는 가장 큰 2의 거듭제곱보다 크면 올림할 수 없다
+    // (그대로 두면 자리 올림이 넘쳐 0이 되고 반복문이 끝나지 않는다)
+    static size_t roundUpPowerOfTwo(size_t n) {
+        if (n > (numeric_limits<size_t>::max() >> 1) + 1) {
+            throw length_error("RingDeque 용량이 너무 큽니다");
+        }
+        size_t result = 1;
+        while (result < n) result <<= 1;
+        return result;
+    }
+
+    // 새 배열로 옮기면서 요소를 0번부터 차례로 편다.
+    // 복사가 중간에 실패하면 새 배열에 만든 것만 정리하고 원본은 그대로 둔다
+    void reallocate(size_t newCapacity) {
+        // 용량 * sizeof(T)가 넘치면 작은 배열을 할당하게 되므로 미리 막는다
+        if (newCapacity == 0 || newCapacity > numeric_limits<size_t>::max() / sizeof(T)) {
+            throw length_error("RingDeque 용량이 너무 큽니다");
+        }
+        T* newData = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+        size_t built = 0;
+        try {
+            for (; built < count; built++) {
+                ::new (static_cast<void*>(newData + built)) T(std::move_if_noexcept(data[physical(built)]));
+            }
+        }
+        catch (...) {
+            for (size_t i = 0; i < built; i++) newData[i].~T();
+            ::operator delete(newData);
+            throw;
+        }
+        for (size_t i = 0; i < count; i++) data[physical(i)].~T();
+        ::operator delete(data);
+        data = newData;
+        capacityValue = newCapacity;
+        head = 0;
+    }
+
+    // 한 칸을 더 넣을 수 있는지 확인하고 필요하면 늘린다 (제한에 걸리면 false)
+    bool makeRoom() {
+        if (count >= maxSize) return false;
+        if (count == capacityValue) {
+            reallocate(capacityValue == 0 ? 8 : capacityValue * 2);
+        }
+        return true;
+    }
+
+    void checkRoom() {
+        if (!makeRoom()) {
+            throw length_error("RingDeque 용량 제한 초과");
+        }
+    }
+
+    // 빈 칸이 확보된 뒤에 호출한다
+    template<typename... Args>
+    T& placeBack(Args&&... args) {
+        T* slot = ::new (static_cast<void*>(data + physical(count))) T(std::forward<Args>(args)...);
+        count++;
+        return *slot;
+    }
+
+    template<typename... Args>
+    T& placeFront(Args&&... args) {
+        size_t newHead = (head + capacityValue - 1) & mask();
+        T* slot = ::new (static_cast<void*>(data + newHead)) T(std::forward<Args>(args)...);
+        head = newHead;
+        count++;
+        return *slot;
+    }
+
+    // 꽉 차서 재할당이 일어날 참이면 q.push_back(q.front())처럼
+    // 인자가 자기 요소를 가리킬 수 있으므로 먼저 값을 만든다
+    bool mustGrow() const { return count == capacityValue && count < maxSize; }
+
+public:
+    using value_type = T;
+
+    // 용량 제한이 있으면 처음부터 그만큼(2의 거듭제곱으로 올림) 할당하여 이후 할당이 없다
+    explicit RingDeque(size_t limit = numeric_limits<size_t>::max()) : maxSize(limit) {
+        if (limit == 0) throw invalid_argument("용량 제한은 1 이상이어야 합니다");
+        if (limit != numeric_limits<size_t>::max()) {
+            reallocate(roundUpPowerOfTwo(limit));
+        }
+    }
+
+    RingDeque(const RingDeque& other) : maxSize(other.maxSize) {
+        reserve(other.count);
+        for (size_t i = 0; i < other.count; i++) push_back(other[i]);
+    }
+
+    RingDeque(RingDeque&& other) noexcept
+        : data(other.data), capacityValue(other.capacityValue), head(other.head),
+          count(other.count), maxSize(other.maxSize) {
+        other.data = nullptr;
+        other.capacityValue = other.head = other.count = 0;
+    }
+
+    RingDeque& operator=(RingDeque other) noexcept {
+        swap(data, other.data);
+        swap(capacityValue, other.capacityValue);
+        swap(head, other.head);
+        swap(count, other.count);
+        swap(maxSize, other.maxSize);
+        return *this;
+    }
+
+    ~RingDeque() {
+        clear();
+        ::operator delete(data);
+    }
+
+    void reserve(size_t n) {
+        if (n > capacityValue) reallocate(roundUpPowerOfTwo(n));
+    }
+
+    // 양쪽 끝에 추가 (용량 제한에 걸리면 예외)
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (mustGrow()) {
+            T value(std::forward<Args>(args)...);
+            checkRoom();
+            return placeBack(std::move(value));
+        }
+        checkRoom();
+        return placeBack(std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (mustGrow()) {
+            T value(std::forward<Args>(args)...);
+            checkRoom();
+            return placeFront(std::move(value));
+        }
+        checkRoom();
+        return placeFront(std::forward<Args>(args)...);
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    // 용량 제한이 있을 때 예외 없이 실패를 알려주는 버전
+    bool try_push_back(T value) {
+        if (!makeRoom()) return false;
+        placeBack(std::move(value));
+        return true;
+    }
+
+    bool try_push_front(T value) {
+        if (!makeRoom()) return false;
+        placeFront(std::move(value));
+        return true;
+    }
+
+    void pop_front() {
+        if (count == 0) throw out_of_range("빈 RingDeque에서 pop_front 호출");
+        data[head].~T();
+        head = (head + 1) & mask();
+        count--;
+    }
+
+    void pop_back() {
+        if (count == 0) throw out_of_range("빈 RingDeque에서 pop_back 호출");
+        data[physical(count - 1)].~T();
+        count--;
+    }
+
+    // 앞 요소를 꺼내서 반환 (큐로 쓸 때 편리)
+    T take_front() {
+        if (count == 0) throw out_of_range("빈 RingDeque에서 take_front 호출");
+        T value = std::move(data[head]);
+        pop_front();
+        return value;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < count; i++) {
+            data[physical(i)].~T();
+        }
+        head = count = 0;
+    }
+
+    T& operator[](size_t index) { return data[physical(index)]; }
+    const T& operator[](size_t index) const { return data[physical(index)]; }
+
+    T& front() { return data[head]; }
+    T& back() { return data[physical(count - 1)]; }
+
+    // 내용을 이루는 두 연속 구간. 두 번째 구간은 비어 있을 수 있다
+    struct Segment {
+        T* first;
+        T* last;
+        T* begin() const { return first; }
+        T* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+    };
+
+    pair<Segment, Segment> segments() {
+        if (count == 0) return {{data, data}, {data, data}};
+        size_t firstLength = min(count, capacityValue - head);
+        return {{data + head, data + head + firstLength}, {data, data + (count - firstLength)}};
+    }
+
+    // 반복자: 논리 인덱스를 원형 위치로 바꾸어 접근
+    class iterator {
+    private:
+        RingDeque* deque;
+        size_t index;
+
+    public:
+        iterator(RingDeque* d, size_t i) : deque(d), index(i) {}
+        T& operator*() const { return (*deque)[index]; }
+        T* operator->() const { return &(*deque)[index]; }
+        iterator& operator++() { index++; return *this; }
+        bool operator!=(const iterator& other) const { return index != other.index; }
+        bool operator==(const iterator& other) const { return index == other.index; }
+    };
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, count); }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count >= maxSize; }
+    size_t capacity() const { return capacityValue; }
+    size_t limit() const { return maxSize; }
+};
+
+// 용량 제한이 있는 스레드 간 작업 큐: 가득 차면 생산자가, 비면 소비자가 기다린다
+template<typename T>
+class BlockingQueue {
+private:
+    RingDeque<T> items;
+    mutex mtx;
+    condition_variable notFull;
+    condition_variable notEmpty;
+    bool closed = false;
+
+public:
+    explicit BlockingQueue(size_t limit) : items(limit) {}
+
+    // 공간이 생길 때까지 기다린다. 닫힌 큐에는 넣을 수 없다
+    bool push(T value) {
+        unique_lock<mutex> lock(mtx);
+        notFull.wait(lock, [this] { return !items.full() || closed; });
+        if (closed) return false;
+        items.push_back(std::move(value));
+        lock.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // 기다리지 않는 버전: 가득 차 있으면 바로 false (호출한 쪽이 속도를 줄인다)
+    bool tryPush(T value) {
+        {
+            lock_guard<mutex> lock(mtx);
+            if (closed || !items.try_push_back(std::move(value))) return false;
+        }
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // 큐가 닫히고 비었으면 false
+    bool pop(T& out) {
+        unique_lock<mutex> lock(mtx);
+        notEmpty.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty()) return false;
+        out = items.take_front();
+        lock.unlock();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        {
+            lock_guard<mutex> lock(mtx);
+            closed = true;
+        }
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 작업 큐 패턴: 항상 약 window개가 대기 중인 상태에서 넣고 빼기를 반복
+template<typename Queue>
+double queueWorkload(size_t operations, size_t window, long long& sink) {
+    return measureMs([&] {
+        Queue queue;
+        for (size_t i = 0; i < window; i++) queue.push_back("작업 " + to_string(i));
+        for (size_t i = 0; i < operations; i++) {
+            if (i % 4 == 0) {
+                queue.push_front("긴급");
+                sink += static_cast<long long>(queue.front().size());
+                queue.pop_front();
+            }
+            queue.push_back("작업");
+            sink += static_cast<long long>(queue.front().size());
+            queue.pop_front();
+        }
+    });
+}
+
+int main() {
+    cout << "=== RingDeque 기초 (05_list_map_basic.cpp의 할 일 목록) ===" << endl;
+    RingDeque<string> todoList;
+    todoList.push_back("숙제하기");
+    todoList.push_front("일어나기");
+    todoList.push_back("운동하기");
+
+    cout << "할 일 목록:" << endl;
+    for (const string& todo : todoList) {
+        cout << "- " << todo << endl;
+    }
+
+    todoList.pop_front();
+    cout << "\n첫 번째 일 완료 후:" << endl;
+    for (const string& todo : todoList) {
+        cout << "- " << todo << endl;
+    }
+
+    cout << "\n=== 연속 구간 ===" << endl;
+    RingDeque<int> numbers;
+    for (int i = 1; i <= 6; i++) numbers.push_back(i);
+    numbers.pop_front();
+    numbers.pop_front();
+    for (int i = 7; i <= 9; i++) numbers.push_back(i);  // 배열 끝을 넘어 앞쪽으로 감긴다
+    auto [first, second] = numbers.segments();
+    cout << "용량 " << numbers.capacity() << ", 구간 크기 " << first.size() << " + " << second.size() << ":";
+    for (const auto& segment : {first, second}) {
+        for (int n : segment) cout << " " << n;
+        cout << " |";
+    }
+    cout << endl;
+
+    cout << "\n=== 자기 요소로 추가 (재할당 중에도 안전) ===" << endl;
+    RingDeque<string> echo;
+    for (int i = 0; i < 8; i++) echo.push_back("작업" + to_string(i));
+    echo.push_back(echo.front());   // 가득 찬 상태: 값을 먼저 만들고 재할당한다
+    echo.push_front(echo.back());
+    cout << "크기 " << echo.size() << ", 맨 앞 " << echo.front() << ", 맨 뒤 " << echo.back() << endl;
+
+    cout << "\n=== 용량 제한 ===" << endl;
+    RingDeque<string> bounded(3);
+    for (const char* task : {"A", "B", "C", "D"}) {
+        cout << task << " 추가: " << (bounded.try_push_back(task) ? "성공" : "실패 (가득 참)") << endl;
+    }
+    try {
+        bounded.push_front("Z");
+    }
+    catch (const length_error& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+    try {
+        bounded.reserve(numeric_limits<size_t>::max());
+    }
+    catch (const length_error& e) {
+        cout << "예상된 오류: " << e.what() << " (크기 " << bounded.size() << " 유지)" << endl;
+    }
+
+    cout << "\n=== 벤치마크: 작업 큐 (대기 1000개, 연산 500만 번, ms) ===" << endl;
+    const size_t operations = 5000000;
+    long long sink = 0;
+    cout << "list<string>:      " << queueWorkload<list<string>>(operations, 1000, sink) << endl;
+    cout << "deque<string>:     " << queueWorkload<deque<string>>(operations, 1000, sink) << endl;
+    cout << "RingDeque<string>: " << queueWorkload<RingDeque<string>>(operations, 1000, sink) << endl;
+
+    // 순회: 인덱스 반복자와 연속 구간 비교
+    RingDeque<int> big;
+    list<int> bigList;
+    for (int i = 0; i < 5000000; i++) {
+        big.push_front(i);
+        bigList.push_front(i);
+    }
+    double listIterate = measureMs([&] { for (int n : bigList) sink += n; });
+    double indexIterate = measureMs([&] { for (int n : big) sink += n; });
+    double segmentIterate = measureMs([&] {
+        auto [a, b] = big.segments();
+        for (int n : a) sink += n;
+        for (int n : b) sink += n;
+    });
+    cout << "\n500만 개 순회 - list: " << listIterate << ", 반복자: " << indexIterate
+         << ", 연속 구간: " << segmentIterate << endl;
+
+    cout << "\n=== 생산자/소비자: 용량 1024인 BlockingQueue로 200만 개 전달 ===" << endl;
+    BlockingQueue<int> queue(1024);
+    const int items = 2000000;
+    long long consumed = 0;
+    double ms = measureMs([&] {
+        thread consumer([&] {
+            int value;
+            while (queue.pop(value)) consumed += value;
+        });
+        for (int i = 0; i < items; i++) queue.push(i);  // 가득 차면 소비자를 기다린다
+        queue.close();
+        consumer.join();
+    });
+    cout << "합계 " << consumed << " (기대값 " << static_cast<long long>(items) * (items - 1) / 2 << "), "
+         << static_cast<long long>(items / (ms / 1000.0)) << "개/초" << endl;
+    cout << "(결과 확인용: " << sink << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+/*
+ * 문자열 인터닝
+ * 파일명: 15_string_interner.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 15_string_interner 15_string_interner.cpp
+ * 실행: ./15_string_interner (Linux/Mac) 또는 15_string_interner.exe (Windows)
+ */
+
+/*
+주제: 문자열 인터닝 (String Interning)
+정의: GameObject::name, CollisionEvent::object1/object2(10_game_engine.cpp),
+      StudentManager::studentNames(08_coding_standards.cpp), scores의 키처럼 같은 이름이
+      string으로 여러 번 복사되고, 비교할 때마다 문자열 전체를 비교한다.
+      인터너는 같은 문자열을 한 번만 저장하고 32비트 번호(Symbol)를 돌려준다.
+
+핵심 개념: 심볼, 아레나 저장소, 안정된 string_view, 스레드 안전 모드
+정의:
+- 심볼: 4바이트 정수. 같은 인터너에서 나온 심볼은 번호가 같으면 문자열도 같다.
+  그래서 비교는 정수 비교 한 번이고, 해시 테이블 키로 쓰기도 쉽다
+- 아레나 저장소: 문자들은 큰 블록에 이어 붙여 저장하고 인터너가 사라질 때 한꺼번에 해제한다.
+  블록은 옮기지 않으므로 view()가 돌려준 string_view는 인터너가 살아 있는 동안 유효하다
+- 스레드 안전 모드: StringInterner<true>는 intern()을 뮤텍스로 보호한다.
+  번호 → 문자열 표는 옮기지 않는 구간들로 나누어 두어 view()는 잠금 없이 읽는다
+- 범위: 인터너 객체 하나가 하나의 아레나이다. 프로그램 전체에서 쓸 때는 globalInterner()를 사용한다
+*/
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+// 인터닝된 문자열의 번호. 기본값(0)은 빈 문자열
+struct Symbol {
+    uint32_t id = 0;
+
+    bool operator==(Symbol other) const { return id == other.id; }
+    bool operator!=(Symbol other) const { return id != other.id; }
+    bool operator<(Symbol other) const { return id < other.id; }  // 번호 순서 (사전 순서 아님)
+};
+
+namespace std {
+    template<>
+    struct hash<Symbol> {
+        size_t operator()(Symbol s) const noexcept { return hash<uint32_t>{}(s.id); }
+    };
+}
+
+// 잠금이 필요 없는 모드에서 쓰는 빈 뮤텍스
+struct NullMutex {
+    void lock() {}
+    void unlock() {}
+};
+
+template<bool ThreadSafe = false>
+class StringInterner {
+private:
+    using Mutex = conditional_t<ThreadSafe, mutex, NullMutex>;
+
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    // 번호 → 문자열 표: 구간 s는 FIRST_SEGMENT * 2^s칸. 구간은 한 번 만들면 옮기지 않는다
+    static constexpr size_t FIRST_SEGMENT = 1024;
+    static constexpr size_t SEGMENT_COUNT = 23;  // 1024 * (2^23 - 1) > 2^32
+
+    // 문자 아레나
+    vector<unique_ptr<char[]>> blocks;
+    size_t blockUsed = BLOCK_SIZE;
+    size_t totalBytes = 0;
+
+    array<atomic<string_view*>, SEGMENT_COUNT> segments{};
+    unordered_map<string_view, uint32_t> index;  // 키는 아레나 안의 문자열을 가리킨다
+    atomic<uint32_t> count{0};
+    mutable Mutex mtx;
+
+    static void locate(uint32_t id, size_t& segment, size_t& offset) {
+        size_t n = id / FIRST_SEGMENT + 1;
+        segment = 63 - static_cast<size_t>(__builtin_clzll(n));
+        offset = id - FIRST_SEGMENT * ((size_t(1) << segment) - 1);
+    }
+
+    string_view store(string_view text) {
+        if (text.size() > BLOCK_SIZE / 4) {
+            // 긴 문자열은 전용 블록에 저장 (현재 블록의 남은 공간은 그대로 사용)
+            blocks.emplace(blocks.begin(), new char[text.size()]);
+            memcpy(blocks.front().get(), text.data(), text.size());
+            totalBytes += text.size();
+            return string_view(blocks.front().get(), text.size());
+        }
+        if (blockUsed + text.size() > BLOCK_SIZE) {
+            blocks.emplace_back(new char[BLOCK_SIZE]);
+            blockUsed = 0;
+        }
+        char* dest = blocks.back().get() + blockUsed;
+        memcpy(dest, text.data(), text.size());
+        blockUsed += text.size();
+        totalBytes += text.size();
+        return string_view(dest, text.size());
+    }
+
+    uint32_t append(string_view stored) {
+        uint32_t id = count.load(memory_order_relaxed);
+        if (id == UINT32_MAX) {
+            throw length_error("심볼 번호가 모두 소진되었습니다");
+        }
+        size_t segment, offset;
+        locate(id, segment, offset);
+        string_view* table = segments[segment].load(memory_order_relaxed);
+        if (!table) {
+            table = new string_view[FIRST_SEGMENT << segment];
+            segments[segment].store(table, memory_order_release);
+        }
+        table[offset] = stored;
+        count.store(id + 1, memory_order_release);
+        return id;
+    }
+
+public:
+    StringInterner() {
+        index.emplace(string_view(), append(string_view()));  // 0번은 빈 문자열
+    }
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    ~StringInterner() {
+        for (auto& segment : segments) {
+            delete[] segment.load(memory_order_relaxed);
+        }
+    }
+
+    // 이미 있으면 기존 번호, 없으면 복사해 두고 새 번호
+    Symbol intern(string_view text) {
+        lock_guard<Mutex> lock(mtx);
+        auto it = index.find(text);
+        if (it != index.end()) {
+            return Symbol{it->second};
+        }
+        string_view stored = store(text);
+        uint32_t id = append(stored);
+        index.emplace(stored, id);
+        return Symbol{id};
+    }
+
+    // 등록하지 않고 찾기만 한다 (없으면 false)
+    bool lookup(string_view text, Symbol& out) const {
+        lock_guard<Mutex> lock(mtx);
+        auto it = index.find(text);
+        if (it == index.end()) return false;
+        out = Symbol{it->second};
+        return true;
+    }
+
+    // 잠금 없이 문자열을 읽는다. 반환값은 인터너가 살아 있는 동안 유효하다
+    string_view view(Symbol symbol) const {
+        if (symbol.id >= count.load(memory_order_acquire)) {
+            throw out_of_range("이 인터너에서 만든 심볼이 아닙니다: " + to_string(symbol.id));
+        }
+        size_t segment, offset;
+        locate(symbol.id, segment, offset);
+        return segments[segment].load(memory_order_acquire)[offset];
+    }
+
+    size_t size() const { return count.load(memory_order_acquire); }
+    size_t bytesStored() const {
+        lock_guard<Mutex> lock(mtx);
+        return totalBytes;
+    }
+};
+
+// 프로그램 전체에서 공유하는 인터너 (여러 스레드에서 사용 가능)
+StringInterner<true>& globalInterner() {
+    static StringInterner<true> instance;
+    return instance;
+}
+
+Symbol intern(string_view text) { return globalInterner().intern(text); }
+string_view nameOf(Symbol symbol) { return globalInterner().view(symbol); }
+
+// ---------- 10_game_engine.cpp의 구조를 심볼로 ----------
+struct Vector2D {
+    float x, y;
+};
+
+struct CollisionEvent {
+    Symbol object1, object2;  // string 두 개(64바이트) 대신 8바이트
+    Vector2D position;
+};
+
+class GameObject {
+private:
+    Symbol name;
+    Vector2D position;
+
+public:
+    GameObject(string_view n, Vector2D pos) : name(intern(n)), position(pos) {}
+    Symbol getName() const { return name; }
+    string_view getNameText() const { return nameOf(name); }
+    Vector2D getPosition() const { return position; }
+};
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    cout << "=== 심볼 기초 ===" << endl;
+    StringInterner<> names;  // 이 블록에서만 쓰는 아레나
+    Symbol a = names.intern("김철수");
+    Symbol b = names.intern("이영희");
+    Symbol c = names.intern(string("김철수"));
+    cout << "김철수 = " << a.id << ", 이영희 = " << b.id << ", 다시 김철수 = " << c.id << endl;
+    cout << "a == c? " << (a == c ? "예" : "아니오") << " (정수 비교)" << endl;
+    cout << "view(b): " << names.view(b) << endl;
+
+    Symbol found;
+    cout << "박민수 등록됨? " << (names.lookup("박민수", found) ? "예" : "아니오") << endl;
+
+    cout << "\n=== 게임 오브젝트와 충돌 이벤트 ===" << endl;
+    vector<GameObject> objects = {
+        {"Hero", {0, 0}}, {"Goblin", {3, 4}}, {"Goblin", {5, 1}}, {"Potion", {2, 2}}
+    };
+    vector<CollisionEvent> events;
+    for (size_t i = 0; i < objects.size(); i++) {
+        for (size_t j = i + 1; j < objects.size(); j++) {
+            events.push_back({objects[i].getName(), objects[j].getName(), objects[j].getPosition()});
+        }
+    }
+    Symbol goblin = intern("Goblin");
+    for (const auto& e : events) {
+        if (e.object1 == goblin || e.object2 == goblin) {
+            cout << nameOf(e.object1) << " <-> " << nameOf(e.object2) << endl;
+        }
+    }
+    cout << "sizeof(CollisionEvent): " << sizeof(CollisionEvent)
+         << " (string 버전: " << sizeof(string) * 2 + sizeof(Vector2D) << ")" << endl;
+
+    cout << "\n=== 중복 학생 확인 (08_coding_standards.cpp의 studentNames) ===" << endl;
+    StringInterner<> roster;
+    unordered_set<Symbol> enrolled;
+    for (const char* student : {"김철수", "이영희", "박민수", "김철수"}) {
+        bool added = enrolled.insert(roster.intern(student)).second;
+        cout << student << (added ? " 추가" : " 이미 등록됨") << endl;
+    }
+
+    cout << "\n=== 스레드 안전 모드: 4개 스레드가 같은 이름 1만 개를 등록 ===" << endl;
+    {
+        StringInterner<true> shared;
+        vector<vector<Symbol>> results(4);
+        vector<thread> workers;
+        for (int t = 0; t < 4; t++) {
+            workers.emplace_back([&, t] {
+                for (int i = 0; i < 10000; i++) {
+                    int k = (t % 2 == 0) ? i : 9999 - i;  // 서로 다른 순서로 등록
+                    results[t].push_back(shared.intern("player_" + to_string(k)));
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+
+        bool consistent = shared.size() == 10001;  // 빈 문자열 포함
+        for (int t = 0; t < 4; t++) {
+            for (int i = 0; i < 10000; i++) {
+                int k = (t % 2 == 0) ? i : 9999 - i;
+                consistent = consistent && shared.view(results[t][i]) == "player_" + to_string(k);
+            }
+        }
+        cout << "같은 이름은 같은 심볼, 총 " << shared.size() << "개: " << (consistent ? "예" : "아니오") << endl;
+    }
+
+    cout << "\n=== 벤치마크: 이름 100만 개 (서로 다른 이름 1000개) ===" << endl;
+    const size_t count = 1000000;
+    vector<string> distinct;
+    for (int i = 0; i < 1000; i++) {
+        distinct.push_back("GameObject_Enemy_Goblin_Warrior_" + to_string(i));  // 앞부분이 같은 긴 이름
+    }
+
+    vector<string> asStrings;
+    vector<Symbol> asSymbols;
+    StringInterner<> pool;
+    double stringBuild = measureMs([&] {
+        for (size_t i = 0; i < count; i++) asStrings.push_back(distinct[(i * 7) % distinct.size()]);
+    });
+    double symbolBuild = measureMs([&] {
+        for (size_t i = 0; i < count; i++) asSymbols.push_back(pool.intern(distinct[(i * 7) % distinct.size()]));
+    });
+
+    size_t stringBytes = asStrings.size() * sizeof(string);
+    for (const auto& s : asStrings) stringBytes += s.capacity() + 1;
+    size_t symbolBytes = asSymbols.size() * sizeof(Symbol) + pool.bytesStored();
+
+    string target = distinct[500];
+    Symbol targetSymbol = pool.intern(target);
+    size_t stringMatches = 0, symbolMatches = 0;
+    double stringCompare = measureMs([&] {
+        for (int r = 0; r < 10; r++)
+            for (const auto& s : asStrings) stringMatches += (s == target);
+    });
+    double symbolCompare = measureMs([&] {
+        for (int r = 0; r < 10; r++)
+            for (Symbol s : asSymbols) symbolMatches += (s == targetSymbol);
+    });
+
+    cout << "생성 (ms)       - string: " << stringBuild << ", Symbol: " << symbolBuild << endl;
+    cout << "메모리 (MB)     - string: " << stringBytes / 1e6 << ", Symbol + 아레나: " << symbolBytes / 1e6 << endl;
+    cout << "비교 1000만 번 (ms) - string: " << stringCompare << ", Symbol: " << symbolCompare
+         << " (일치 " << stringMatches << " / " << symbolMatches << ")" << endl;
+
+    return 0;
+}
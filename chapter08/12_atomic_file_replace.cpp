@@ -0,0 +1,667 @@
+/*
+ * 원자적 파일 교체와 CRC32C 레코드
+ * 파일명: 12_atomic_file_replace.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 12_atomic_file_replace 12_atomic_file_replace.cpp
+ * 실행: ./12_atomic_file_replace (Linux/Mac)
+ */
+
+/*
+주제: 원자적 파일 교체 (Crash-safe Atomic Replace)
+정의: FileManager::writeFile(06_file_io_exception.cpp)은 대상 파일을 그 자리에서 잘라내고
+      다시 쓰므로, 도중에 프로그램이 죽으면 반쯤 쓰인 파일이 남는다.
+      임시 파일에 쓰고 fsync → rename → 디렉터리 fsync 순서로 교체하면
+      다른 프로세스는 항상 "이전 파일" 또는 "새 파일" 중 하나만 보게 된다.
+
+핵심 개념: 레코드 프레이밍, CRC32C, 하드웨어 가속, 스트리밍 검증
+정의:
+- 레코드: [길이 4바이트][CRC32C 4바이트][내용] 형식으로 저장하여 줄 단위 대신
+  레코드 단위로 무결성을 확인한다
+- 추가 쓰기: 큰 파일 전체를 다시 쓰지 않고 끝에 레코드만 덧붙인다.
+  끝부분이 잘린(torn) 레코드는 읽을 때 발견되어 무시되고, 다음 추가 쓰기 전에 잘라낸다
+- CRC32C: SSE4.2의 crc32 명령어(ARM은 CRC 확장)로 계산하고, 지원하지 않는 CPU에서는
+  테이블 방식으로 계산한다. 명령어의 지연(3사이클)이 처리 간격(1사이클)보다 길어서
+  한 줄로 이어 계산하면 처리량의 1/3만 쓰므로, x86-64에서는 세 구간을 동시에 계산한 뒤 합친다
+- 스트리밍 검증: 버퍼로 읽어 들인 바로 그 데이터에 대해 CRC를 계산하므로
+  검증을 위해 파일을 한 번 더 읽지 않는다
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <nmmintrin.h>
+#define CRC32C_X86 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC32C_ARM 1
+#endif
+
+using namespace std;
+
+namespace Crc32c {
+
+    // 소프트웨어 계산용 테이블 (다항식 0x82F63B78, 반사 표현)
+    struct Table {
+        uint32_t data[8][256];
+
+        Table() {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; bit++) {
+                    crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+                }
+                data[0][i] = crc;
+            }
+            // slicing-by-8: 한 번에 8바이트씩 처리하기 위한 보조 테이블
+            for (uint32_t i = 0; i < 256; i++) {
+                for (int k = 1; k < 8; k++) {
+                    data[k][i] = (data[k - 1][i] >> 8) ^ data[0][data[k - 1][i] & 0xFF];
+                }
+            }
+        }
+    };
+
+    inline const Table& table() {
+        static const Table instance;
+        return instance;
+    }
+
+    // crc 인자는 "반전된" 내부 상태. 여러 조각을 이어서 계산할 때 사용
+    inline uint32_t updateSoftware(uint32_t crc, const uint8_t* p, size_t n) {
+        const auto& t = table().data;
+        while (n >= 8) {
+            uint64_t word;
+            memcpy(&word, p, 8);
+            word ^= crc;
+            crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^
+                  t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+                  t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^
+                  t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+            p += 8;
+            n -= 8;
+        }
+        while (n--) {
+            crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+        }
+        return crc;
+    }
+
+#if CRC32C_X86
+#if defined(__x86_64__)
+    // crc32 명령어는 지연이 3사이클이라 한 줄로 이어 계산하면 처리량의 1/3만 쓴다.
+    // 그래서 LANE_BYTES씩 세 구간을 동시에 계산하고, 앞 구간의 CRC를 뒤 구간 길이만큼
+    // "0 바이트를 덧붙인" 값으로 옮겨(shift) XOR 하여 하나로 합친다
+    constexpr size_t LANE_BYTES = 512;
+
+    // CRC 상태를 LANE_BYTES개의 0 바이트 뒤로 옮기는 연산은 상태에 대해 선형이므로,
+    // 각 비트의 결과를 미리 구해 바이트 단위 테이블 4개로 만들어 둔다
+    struct ShiftTable {
+        uint32_t data[4][256];
+
+        ShiftTable() {
+            static const uint8_t zeros[LANE_BYTES] = {};
+            uint32_t basis[32];
+            for (int bit = 0; bit < 32; bit++) {
+                basis[bit] = updateSoftware(1u << bit, zeros, LANE_BYTES);
+            }
+            for (int k = 0; k < 4; k++) {
+                for (uint32_t i = 0; i < 256; i++) {
+                    uint32_t shifted = 0;
+                    for (int bit = 0; bit < 8; bit++) {
+                        if (i & (1u << bit)) shifted ^= basis[8 * k + bit];
+                    }
+                    data[k][i] = shifted;
+                }
+            }
+        }
+
+        uint32_t shift(uint32_t crc) const {
+            return data[0][crc & 0xFF] ^ data[1][(crc >> 8) & 0xFF] ^
+                   data[2][(crc >> 16) & 0xFF] ^ data[3][crc >> 24];
+        }
+    };
+
+    inline const ShiftTable& shiftTable() {
+        static const ShiftTable instance;
+        return instance;
+    }
+#endif
+
+    __attribute__((target("sse4.2")))
+    inline uint32_t updateHardware(uint32_t crc, const uint8_t* p, size_t n) {
+#if defined(__x86_64__)
+        if (n >= 3 * LANE_BYTES) {
+            const ShiftTable& lanes = shiftTable();
+            while (n >= 3 * LANE_BYTES) {
+                uint64_t a = crc, b = 0, c = 0;
+                for (size_t i = 0; i < LANE_BYTES; i += 8) {
+                    uint64_t wa, wb, wc;
+                    memcpy(&wa, p + i, 8);
+                    memcpy(&wb, p + LANE_BYTES + i, 8);
+                    memcpy(&wc, p + 2 * LANE_BYTES + i, 8);
+                    a = _mm_crc32_u64(a, wa);
+                    b = _mm_crc32_u64(b, wb);
+                    c = _mm_crc32_u64(c, wc);
+                }
+                crc = lanes.shift(lanes.shift(static_cast<uint32_t>(a)) ^ static_cast<uint32_t>(b))
+                      ^ static_cast<uint32_t>(c);
+                p += 3 * LANE_BYTES;
+                n -= 3 * LANE_BYTES;
+            }
+        }
+        uint64_t crc64 = crc;
+        while (n >= 8) {
+            uint64_t word;
+            memcpy(&word, p, 8);
+            crc64 = _mm_crc32_u64(crc64, word);
+            p += 8;
+            n -= 8;
+        }
+        crc = static_cast<uint32_t>(crc64);
+#endif
+        while (n--) {
+            crc = _mm_crc32_u8(crc, *p++);
+        }
+        return crc;
+    }
+
+    inline bool hardwareAvailable() {
+        static const bool available = __builtin_cpu_supports("sse4.2");
+        return available;
+    }
+#elif CRC32C_ARM
+    inline uint32_t updateHardware(uint32_t crc, const uint8_t* p, size_t n) {
+        while (n >= 8) {
+            uint64_t word;
+            memcpy(&word, p, 8);
+            crc = __crc32cd(crc, word);
+            p += 8;
+            n -= 8;
+        }
+        while (n--) {
+            crc = __crc32cb(crc, *p++);
+        }
+        return crc;
+    }
+
+    inline bool hardwareAvailable() { return true; }
+#else
+    inline uint32_t updateHardware(uint32_t crc, const uint8_t* p, size_t n) {
+        return updateSoftware(crc, p, n);
+    }
+
+    inline bool hardwareAvailable() { return false; }
+#endif
+
+    // 이어서 계산할 수 있는 CRC 누산기
+    class Accumulator {
+    private:
+        uint32_t state = 0xFFFFFFFFu;
+
+    public:
+        void update(const void* data, size_t n) {
+            auto* p = static_cast<const uint8_t*>(data);
+            state = hardwareAvailable() ? updateHardware(state, p, n) : updateSoftware(state, p, n);
+        }
+
+        uint32_t value() const { return state ^ 0xFFFFFFFFu; }
+    };
+
+    inline uint32_t compute(const void* data, size_t n) {
+        Accumulator acc;
+        acc.update(data, n);
+        return acc.value();
+    }
+
+} // namespace Crc32c
+
+// 무결성 오류 (레코드 CRC 불일치, 헤더 손상 등)
+class IntegrityException : public runtime_error {
+public:
+    explicit IntegrityException(const string& msg) : runtime_error("무결성 오류: " + msg) {}
+};
+
+// 파일 디스크립터 RAII 래퍼
+class FileDescriptor {
+private:
+    int fd;
+
+public:
+    explicit FileDescriptor(int f) : fd(f) {}
+    ~FileDescriptor() {
+        if (fd >= 0) close(fd);
+    }
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const { return fd; }
+    int release() {
+        int f = fd;
+        fd = -1;
+        return f;
+    }
+};
+
+class FileManager {
+private:
+    static constexpr char MAGIC[4] = {'C', 'R', 'C', 'L'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 8;         // 매직 4바이트 + 버전 4바이트
+    static constexpr size_t RECORD_HEADER_SIZE = 8;  // 길이 4바이트 + CRC 4바이트
+    static constexpr uint32_t MAX_RECORD_SIZE = 64u << 20;
+
+    static void writeAll(int fd, const char* data, size_t size, const string& filename) {
+        while (size > 0) {
+            ssize_t n = write(fd, data, size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw runtime_error("파일 쓰기 중 오류가 발생했습니다: " + filename);
+            }
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+    }
+
+    static void appendFrame(string& out, const string& record) {
+        if (record.size() > MAX_RECORD_SIZE) {
+            throw invalid_argument("레코드가 너무 큽니다: " + to_string(record.size()) + "바이트");
+        }
+        uint32_t length = static_cast<uint32_t>(record.size());
+        uint32_t crc = Crc32c::compute(record.data(), record.size());
+        out.append(reinterpret_cast<const char*>(&length), 4);
+        out.append(reinterpret_cast<const char*>(&crc), 4);
+        out.append(record);
+    }
+
+    static string header() {
+        string h(MAGIC, 4);
+        h.append(reinterpret_cast<const char*>(&VERSION), 4);
+        return h;
+    }
+
+    static string directoryOf(const string& path) {
+        auto slash = path.find_last_of('/');
+        if (slash == string::npos) return ".";
+        if (slash == 0) return "/";
+        return path.substr(0, slash);
+    }
+
+    static void syncDirectory(const string& path) {
+        FileDescriptor dir(open(directoryOf(path).c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+        if (dir.get() < 0 || fsync(dir.get()) != 0) {
+            throw runtime_error("디렉터리 동기화 실패: " + directoryOf(path));
+        }
+    }
+
+    // mkstemp는 0600으로 만들므로, 교체 전에 기존 파일의 권한(없으면 0666 & ~umask)을 입힌다
+    static void copyPermissions(int fd, const string& filename, const string& tempName) {
+        struct stat st;
+        mode_t mode;
+        if (stat(filename.c_str(), &st) == 0) {
+            mode = st.st_mode & 07777;
+        } else {
+            mode_t mask = umask(0);  // umask는 읽기 전용 함수가 없어 설정 후 되돌린다
+            umask(mask);
+            mode = 0666 & ~mask;
+        }
+        if (fchmod(fd, mode) != 0) {
+            throw runtime_error("임시 파일 권한 설정 실패: " + tempName);
+        }
+    }
+
+    static bool readExact(int fd, void* out, size_t size, off_t offset) {
+        auto* p = static_cast<char*>(out);
+        while (size > 0) {
+            ssize_t n = pread(fd, p, size, offset);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<size_t>(n);
+            offset += n;
+        }
+        return true;
+    }
+
+    // 마지막 온전한 레코드가 끝나는 위치를 구한다. 레코드 헤더만 따라가며 내용은 건너뛰고,
+    // 크래시로 일부만 기록될 수 있는 마지막 레코드만 CRC를 확인한다
+    static off_t validLength(int fd, off_t fileSize, const string& filename) {
+        if (fileSize < static_cast<off_t>(HEADER_SIZE)) {
+            return 0;  // 헤더조차 다 쓰이지 않았다
+        }
+        char head[HEADER_SIZE];
+        uint32_t version;
+        if (!readExact(fd, head, HEADER_SIZE, 0)) {
+            throw runtime_error("파일 읽기 중 오류가 발생했습니다: " + filename);
+        }
+        memcpy(&version, head + 4, 4);
+        if (memcmp(head, MAGIC, 4) != 0 || version != VERSION) {
+            throw IntegrityException("지원하지 않는 형식: " + filename);
+        }
+
+        off_t offset = HEADER_SIZE;
+        off_t lastStart = -1;
+        uint32_t lastLength = 0, lastCrc = 0;
+        while (fileSize - offset >= static_cast<off_t>(RECORD_HEADER_SIZE)) {
+            uint32_t frame[2];
+            if (!readExact(fd, frame, sizeof(frame), offset)) {
+                throw runtime_error("파일 읽기 중 오류가 발생했습니다: " + filename);
+            }
+            if (frame[0] > MAX_RECORD_SIZE ||
+                fileSize - offset < static_cast<off_t>(RECORD_HEADER_SIZE + frame[0])) {
+                break;  // 길이가 깨졌거나 내용이 끝까지 쓰이지 않은 레코드
+            }
+            lastStart = offset;
+            lastLength = frame[0];
+            lastCrc = frame[1];
+            offset += RECORD_HEADER_SIZE + frame[0];
+        }
+
+        if (lastStart >= 0 && offset == fileSize) {
+            string payload(lastLength, '\0');
+            if (!readExact(fd, &payload[0], lastLength, lastStart + RECORD_HEADER_SIZE)) {
+                throw runtime_error("파일 읽기 중 오류가 발생했습니다: " + filename);
+            }
+            if (Crc32c::compute(payload.data(), payload.size()) != lastCrc) {
+                return lastStart;
+            }
+        }
+        return offset;
+    }
+
+public:
+    // 원자적 교체: 임시 파일 → fsync → rename → 디렉터리 fsync
+    static void writeFileAtomic(const string& filename, const vector<string>& records) {
+        string tempName = filename + ".tmp.XXXXXX";
+        FileDescriptor temp(mkstemp(&tempName[0]));
+        if (temp.get() < 0) {
+            throw runtime_error("임시 파일을 생성할 수 없습니다: " + tempName);
+        }
+
+        try {
+            // 레코드를 버퍼에 모아 큰 단위로 쓴다
+            string buffer = header();
+            for (const auto& record : records) {
+                appendFrame(buffer, record);
+                if (buffer.size() >= (1u << 20)) {
+                    writeAll(temp.get(), buffer.data(), buffer.size(), tempName);
+                    buffer.clear();
+                }
+            }
+            writeAll(temp.get(), buffer.data(), buffer.size(), tempName);
+            copyPermissions(temp.get(), filename, tempName);
+
+            if (fsync(temp.get()) != 0) {
+                throw runtime_error("임시 파일 동기화 실패: " + tempName);
+            }
+            close(temp.release());
+
+            if (rename(tempName.c_str(), filename.c_str()) != 0) {
+                throw runtime_error("파일 교체 실패: " + filename);
+            }
+        }
+        catch (...) {
+            unlink(tempName.c_str());  // 실패하면 원본은 그대로, 임시 파일만 삭제
+            throw;
+        }
+
+        // rename 자체가 디스크에 기록되도록 디렉터리도 동기화
+        syncDirectory(filename);
+        cout << "원자적 파일 쓰기 완료: " << filename << " (" << records.size() << "개 레코드)" << endl;
+    }
+
+    // 파일 전체를 다시 쓰지 않고 레코드만 덧붙인다.
+    // 이전 추가 쓰기가 도중에 죽어 끝에 잘린 레코드가 있으면 먼저 잘라낸다.
+    // 그대로 덧붙이면 잘린 레코드 뒤의 모든 레코드를 읽을 수 없게 된다
+    static void appendRecords(const string& filename, const vector<string>& records, bool durable = true) {
+        FileDescriptor fd(open(filename.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644));
+        if (fd.get() < 0) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+
+        struct stat st;
+        if (fstat(fd.get(), &st) != 0) {
+            throw runtime_error("파일 정보를 읽을 수 없습니다: " + filename);
+        }
+        off_t valid = validLength(fd.get(), st.st_size, filename);
+        if (valid < st.st_size) {
+            if (ftruncate(fd.get(), valid) != 0) {
+                throw runtime_error("잘린 레코드 제거 실패: " + filename);
+            }
+            cout << "잘린 마지막 레코드 제거: " << (st.st_size - valid) << "바이트" << endl;
+        }
+
+        string buffer;
+        if (valid == 0) {
+            buffer = header();
+        }
+        for (const auto& record : records) {
+            appendFrame(buffer, record);
+        }
+        // 한 번의 write로 붙이면 O_APPEND 덕분에 다른 추가 쓰기와 섞이지 않는다
+        writeAll(fd.get(), buffer.data(), buffer.size(), filename);
+
+        if (durable && fdatasync(fd.get()) != 0) {
+            throw runtime_error("파일 동기화 실패: " + filename);
+        }
+    }
+
+    struct ReadStats {
+        size_t records = 0;
+        size_t bytes = 0;
+        bool tornTail = false;  // 끝부분이 불완전한 레코드로 끝났는지
+    };
+
+    // 스트리밍 검증: 한 번 읽은 버퍼에서 CRC 계산과 레코드 전달을 함께 수행
+    static ReadStats readRecords(const string& filename, const function<void(const string&)>& onRecord) {
+        FileDescriptor fd(open(filename.c_str(), O_RDONLY | O_CLOEXEC));
+        if (fd.get() < 0) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+
+        ReadStats stats;
+        vector<char> buffer(1 << 20);
+        size_t begin = 0, end = 0;
+        bool headerChecked = false;
+        bool eof = false;
+        string record;
+
+        while (true) {
+            // 버퍼에 남은 조각을 앞으로 옮기고 다음 블록을 읽는다
+            if (!eof) {
+                if (begin > 0) {
+                    memmove(buffer.data(), buffer.data() + begin, end - begin);
+                    end -= begin;
+                    begin = 0;
+                }
+                ssize_t n = read(fd.get(), buffer.data() + end, buffer.size() - end);
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+                }
+                if (n == 0) eof = true;
+                end += static_cast<size_t>(n);
+            }
+
+            if (!headerChecked) {
+                if (end - begin < HEADER_SIZE) {
+                    if (eof) throw IntegrityException("헤더가 없습니다: " + filename);
+                    continue;
+                }
+                uint32_t version;
+                memcpy(&version, buffer.data() + begin + 4, 4);
+                if (memcmp(buffer.data() + begin, MAGIC, 4) != 0 || version != VERSION) {
+                    throw IntegrityException("지원하지 않는 형식: " + filename);
+                }
+                begin += HEADER_SIZE;
+                headerChecked = true;
+            }
+
+            // 버퍼 안에 완전히 들어온 레코드들을 처리
+            while (end - begin >= RECORD_HEADER_SIZE) {
+                uint32_t length, storedCrc;
+                memcpy(&length, buffer.data() + begin, 4);
+                memcpy(&storedCrc, buffer.data() + begin + 4, 4);
+                if (length > MAX_RECORD_SIZE) {
+                    throw IntegrityException("레코드 길이 손상 (레코드 " + to_string(stats.records) + ")");
+                }
+                if (RECORD_HEADER_SIZE + length > buffer.size()) {
+                    buffer.resize(RECORD_HEADER_SIZE + length);  // 버퍼보다 큰 레코드
+                }
+                if (end - begin < RECORD_HEADER_SIZE + length) {
+                    break;
+                }
+
+                const char* payload = buffer.data() + begin + RECORD_HEADER_SIZE;
+                if (Crc32c::compute(payload, length) != storedCrc) {
+                    throw IntegrityException("CRC 불일치 (레코드 " + to_string(stats.records) + ")");
+                }
+                record.assign(payload, length);
+                onRecord(record);
+
+                begin += RECORD_HEADER_SIZE + length;
+                stats.records++;
+                stats.bytes += length;
+            }
+
+            if (eof) {
+                stats.tornTail = (end - begin) > 0;
+                return stats;
+            }
+        }
+    }
+
+    static vector<string> readFile(const string& filename) {
+        vector<string> records;
+        auto stats = readRecords(filename, [&records](const string& r) { records.push_back(r); });
+        if (stats.tornTail) {
+            cout << "경고: 마지막 레코드가 불완전하여 무시했습니다: " << filename << endl;
+        }
+        cout << "파일 읽기 완료: " << filename << " (" << records.size() << "개 레코드)" << endl;
+        return records;
+    }
+};
+
+int main() {
+    cout << "=== 원자적 파일 교체와 CRC32C ===" << endl;
+    cout << "하드웨어 CRC32C: " << (Crc32c::hardwareAvailable() ? "사용" : "미지원 (테이블 방식)") << endl;
+
+    // 0. 표준 검사값: CRC32C("123456789") = 0xE3069283
+    const char* check = "123456789";
+    uint32_t hw = Crc32c::updateHardware(0xFFFFFFFFu, reinterpret_cast<const uint8_t*>(check), 9) ^ 0xFFFFFFFFu;
+    uint32_t sw = Crc32c::updateSoftware(0xFFFFFFFFu, reinterpret_cast<const uint8_t*>(check), 9) ^ 0xFFFFFFFFu;
+    cout << hex << "검사값: 하드웨어 0x" << hw << ", 소프트웨어 0x" << sw << dec << endl;
+
+    // 1. 원자적 쓰기와 추가 쓰기
+    try {
+        FileManager::writeFileAtomic("records.dat", {"첫 번째 레코드", "두 번째 레코드", "세 번째 레코드"});
+        FileManager::appendRecords("records.dat", {"추가된 레코드"});
+
+        auto records = FileManager::readFile("records.dat");
+        for (const auto& record : records) {
+            cout << "  " << record << endl;
+        }
+
+        struct stat st;
+        if (stat("records.dat", &st) == 0) {
+            cout << "파일 권한: " << oct << (st.st_mode & 0777) << dec << " (mkstemp 기본값 600이 아님)" << endl;
+        }
+    }
+    catch (const exception& e) {
+        cout << "파일 작업 오류: " << e.what() << endl;
+    }
+
+    // 2. 추가 쓰기 도중 죽은 경우 (끝부분이 잘린 레코드)
+    cout << "\n=== 불완전한 마지막 레코드 ===" << endl;
+    try {
+        FileDescriptor fd(open("records.dat", O_WRONLY | O_APPEND));
+        uint32_t fakeLength = 100;
+        if (write(fd.get(), &fakeLength, 4) != 4) {
+            throw runtime_error("테스트 데이터 쓰기 실패");
+        }
+        FileManager::readFile("records.dat");
+
+        // 다음 추가 쓰기는 잘린 레코드를 먼저 잘라내므로 이후 레코드도 계속 읽힌다
+        FileManager::appendRecords("records.dat", {"크래시 후 추가된 레코드"});
+        auto records = FileManager::readFile("records.dat");
+        cout << "  마지막 레코드: " << records.back() << endl;
+    }
+    catch (const exception& e) {
+        cout << "오류: " << e.what() << endl;
+    }
+
+    // 3. 내용이 손상된 경우
+    cout << "\n=== 손상된 레코드 ===" << endl;
+    try {
+        FileDescriptor fd(open("records.dat", O_WRONLY));
+        if (pwrite(fd.get(), "X", 1, 20) != 1) {
+            throw runtime_error("테스트 데이터 쓰기 실패");
+        }
+        FileManager::readFile("records.dat");
+    }
+    catch (const IntegrityException& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+
+    // 4. 손상된 파일도 원자적 교체로 안전하게 복구
+    try {
+        FileManager::writeFileAtomic("records.dat", {"복구된 레코드"});
+        FileManager::readFile("records.dat");
+    }
+    catch (const exception& e) {
+        cout << "복구 오류: " << e.what() << endl;
+    }
+
+    // 5. CRC 계산 속도 비교
+    cout << "\n=== CRC32C 처리량 (64MB) ===" << endl;
+    {
+        vector<uint8_t> data(64u << 20);
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+        }
+
+        auto measure = [&data](const char* label, uint32_t (*fn)(uint32_t, const uint8_t*, size_t)) {
+            auto start = chrono::steady_clock::now();
+            uint32_t crc = fn(0xFFFFFFFFu, data.data(), data.size());
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            cout << label << ": " << (data.size() / seconds / (1u << 30)) << " GB/s (crc=0x"
+                 << hex << (crc ^ 0xFFFFFFFFu) << dec << ")" << endl;
+        };
+
+        measure("테이블 방식", Crc32c::updateSoftware);
+        if (Crc32c::hardwareAvailable()) {
+            measure("하드웨어", Crc32c::updateHardware);
+        }
+    }
+
+    // 6. 대용량 파일: 쓰기 후 한 번의 읽기로 검증
+    cout << "\n=== 대용량 파일 스트리밍 검증 ===" << endl;
+    try {
+        vector<string> records(200000, string(200, 'r'));
+        auto start = chrono::steady_clock::now();
+        FileManager::writeFileAtomic("large_records.dat", records);
+        double writeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        auto stats = FileManager::readRecords("large_records.dat", [](const string&) {});
+        double readMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        cout << "쓰기: " << writeMs << "ms, 검증 읽기: " << readMs << "ms ("
+             << stats.records << "개 레코드, " << stats.bytes / (1 << 20) << "MB)" << endl;
+    }
+    catch (const exception& e) {
+        cout << "대용량 파일 오류: " << e.what() << endl;
+    }
+
+    return 0;
+}
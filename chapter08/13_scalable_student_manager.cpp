@@ -0,0 +1,874 @@
+/*
+ * 대용량 StudentManager
+ * 파일명: 13_scalable_student_manager.cpp
+ *
+ * 컴파일: g++ -std=c++20 -O2 -o 13_scalable_student_manager 13_scalable_student_manager.cpp
+ * 실행: ./13_scalable_student_manager (Linux/Mac) 또는 13_scalable_student_manager.exe (Windows)
+ */
+
+/*
+주제: 대용량 StudentManager (Scalable Student Manager)
+정의: 08_coding_standards.cpp의 StudentManager::addStudent는 추가할 때마다 std::find로
+      studentNames 전체를 훑어 중복을 검사한다. 학생 n명을 등록하면 O(n²)이 되어
+      수백만 명 명단은 사실상 불러올 수 없다.
+
+핵심 개념: 해시 색인, 일괄 추가, 선택적 용량 제한, 증분 통계, 표 기반 등급 분류
+정의:
+- 해시 색인: 이름 → 행 번호를 찾는 개방 주소법 테이블을 이름/점수 열과 함께 유지한다.
+  테이블에는 행 번호와 해시값만 저장하므로 studentNames가 재할당되어도 색인은 그대로 유효하다
+- 일괄 추가: addStudents(span)는 검증과 중복 제거(기존 학생 + 같은 묶음 안의 중복)를
+  한 번의 순회로 처리하고, 공간은 미리 한 번에 확보한다. 결과는 항목별 출력 대신 개수로 돌려준다
+- 선택적 용량 제한: 최대 인원은 optional로 받는다. 지정하지 않으면 제한이 없다
+- 증분 통계: 학생을 추가할 때 개수/합/제곱합/등급별 개수를 함께 갱신하므로
+  getAverageScore는 전체를 다시 훑지 않고 O(1)이다. 백분위수는 0.01점 단위 구간의
+  펜윅 트리(Fenwick tree)로 O(log 구간 수)에 답한다. 소수 둘째 자리까지의 점수는 정확하고,
+  그보다 세밀한 점수도 오차가 0.01점 미만이다
+- 표 기반 등급 분류: if 사슬 대신 "넘은 기준 점수의 개수"로 등급을 정한다. 비교 결과를
+  더하기만 하므로 분기가 없고, classifyGrades는 SSE2로 점수 두 개씩 한 번에 비교한다
+- 할당 없는 출력: gradeToString은 정적 표의 string_view를 돌려주고, displayAllStudents는
+  한 줄씩 to_chars로 고정 버퍼에 써서 모아 내보낸다. 100만 줄을 출력해도 힙 할당이 없다
+- std::span을 사용하므로 이 예제는 -std=c++20이 필요하다
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <optional>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
+#include <new>
+#include <random>
+#include <chrono>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace MyProject {
+
+    const size_t MAX_STUDENTS = 100;
+
+    enum class Grade {
+        A_PLUS,
+        A,
+        B_PLUS,
+        B,
+        C_PLUS,
+        C,
+        D,
+        F
+    };
+
+    const size_t GRADE_COUNT = 8;
+
+    // 등급 기준 점수 (높은 순). 넘은 기준의 개수 c에 대해 등급 번호는 7 - c
+    constexpr std::array<double, GRADE_COUNT - 1> GRADE_THRESHOLDS = {97.0, 93.0, 90.0, 87.0, 83.0, 80.0, 70.0};
+
+    constexpr std::array<string_view, GRADE_COUNT> GRADE_NAMES = {"A+", "A", "B+", "B", "C+", "C", "D", "F"};
+
+    struct StudentRecord {
+        string name;
+        double score;
+    };
+
+    // 일괄 추가 결과: 추가된 수와 거부된 이유별 개수
+    struct BulkAddResult {
+        size_t added = 0;
+        size_t emptyName = 0;
+        size_t invalidScore = 0;
+        size_t duplicate = 0;
+        size_t overCapacity = 0;
+
+        size_t rejected() const { return emptyName + invalidScore + duplicate + overCapacity; }
+    };
+
+    // 이름 → 행 번호 색인 (선형 탐사, 최대 적재율 1/2)
+    // 문자열 자체는 저장하지 않고, 비교할 때 호출한 쪽의 이름 열을 참조한다
+    class NameIndex {
+    private:
+        static constexpr uint32_t EMPTY = UINT32_MAX;
+
+        struct Slot {
+            uint32_t row = EMPTY;
+            uint32_t hash = 0;   // 재해시할 때 문자열을 다시 해시하지 않기 위해 저장
+        };
+
+        vector<Slot> slots;
+        size_t count = 0;
+        int shift = 32;          // 위치 = (hash * 황금비 상수) >> shift
+
+        static uint32_t hashOf(string_view name) {
+            return static_cast<uint32_t>(std::hash<string_view>{}(name));
+        }
+
+        size_t home(uint32_t hash) const {
+            return static_cast<size_t>((hash * 0x9E3779B1u) >> shift);
+        }
+
+        void rehash(size_t newCapacity) {
+            vector<Slot> old = std::move(slots);
+            slots.assign(newCapacity, Slot{});
+            shift = 32 - std::countr_zero(newCapacity);
+            size_t mask = newCapacity - 1;
+            for (const Slot& s : old) {
+                if (s.row == EMPTY) continue;
+                size_t pos = home(s.hash);
+                while (slots[pos].row != EMPTY) pos = (pos + 1) & mask;
+                slots[pos] = s;
+            }
+        }
+
+    public:
+        NameIndex() { rehash(16); }
+
+        // n개까지 재해시 없이 넣을 수 있도록 확보
+        void reserve(size_t n) {
+            size_t needed = slots.size();
+            while (needed < n * 2) needed *= 2;
+            if (needed > slots.size()) rehash(needed);
+        }
+
+        // 이름이 있으면 기존 행 번호, 없으면 newRow로 등록하고 nullopt
+        // (찾기와 삽입을 한 번의 탐사로 처리)
+        std::optional<uint32_t> findOrInsert(string_view name, uint32_t newRow,
+                                             const vector<string>& names) {
+            if ((count + 1) * 2 > slots.size()) rehash(std::max<size_t>(16, slots.size() * 2));
+            uint32_t hash = hashOf(name);
+            size_t mask = slots.size() - 1;
+            for (size_t pos = home(hash);; pos = (pos + 1) & mask) {
+                Slot& s = slots[pos];
+                if (s.row == EMPTY) {
+                    s = Slot{newRow, hash};
+                    count++;
+                    return std::nullopt;
+                }
+                if (s.hash == hash && names[s.row] == name) {
+                    return s.row;
+                }
+            }
+        }
+
+        std::optional<uint32_t> find(string_view name, const vector<string>& names) const {
+            if (slots.empty()) return std::nullopt;  // 이동된 뒤의 빈 색인
+            uint32_t hash = hashOf(name);
+            size_t mask = slots.size() - 1;
+            for (size_t pos = home(hash);; pos = (pos + 1) & mask) {
+                const Slot& s = slots[pos];
+                if (s.row == EMPTY) return std::nullopt;
+                if (s.hash == hash && names[s.row] == name) return s.row;
+            }
+        }
+
+        size_t memoryBytes() const { return slots.capacity() * sizeof(Slot); }
+    };
+
+    // 대시보드용 요약 (모든 값이 O(1)로 준비됨)
+    struct ScoreSummary {
+        size_t count = 0;
+        double mean = 0.0;
+        double standardDeviation = 0.0;
+        double minScore = 0.0;
+        double maxScore = 0.0;
+        std::array<size_t, GRADE_COUNT> gradeCounts{};
+    };
+
+    // 점수 통계: 추가할 때마다 갱신하고, 조회는 O(1) 또는 O(log B)
+    class ScoreStatistics {
+    public:
+        static constexpr int RESOLUTION = 100;                           // 0.01점 단위
+        static constexpr size_t BUCKETS = 100 * RESOLUTION + 1;          // 0.00 ~ 100.00
+
+    private:
+        size_t count = 0;
+        double sum = 0.0;
+        double sumSquares = 0.0;
+        double minScore = 0.0;
+        double maxScore = 0.0;
+        std::array<size_t, GRADE_COUNT> gradeCounts{};
+        vector<uint64_t> fenwick = vector<uint64_t>(BUCKETS + 1, 0);     // 1번부터 사용
+
+        static size_t bucketOf(double score) {
+            // 95.5 * 100이 9549.999...가 되는 경우를 막기 위해 작은 값을 더한다
+            return std::min(BUCKETS - 1, static_cast<size_t>(score * RESOLUTION + 1e-6));
+        }
+
+    public:
+        ScoreStatistics() = default;
+
+        // 옮겨진 쪽은 빈 통계가 된다. 트리는 할당 없이 넘기고(noexcept), 빈 트리는 다음 add에서 다시 만든다
+        ScoreStatistics(ScoreStatistics&& other) noexcept
+            : count(std::exchange(other.count, 0)),
+              sum(std::exchange(other.sum, 0.0)),
+              sumSquares(std::exchange(other.sumSquares, 0.0)),
+              minScore(std::exchange(other.minScore, 0.0)),
+              maxScore(std::exchange(other.maxScore, 0.0)),
+              gradeCounts(std::exchange(other.gradeCounts, {})),
+              fenwick(std::move(other.fenwick)) {
+            other.fenwick.clear();
+        }
+
+        ScoreStatistics& operator=(ScoreStatistics&& other) noexcept {
+            if (this != &other) {
+                count = std::exchange(other.count, 0);
+                sum = std::exchange(other.sum, 0.0);
+                sumSquares = std::exchange(other.sumSquares, 0.0);
+                minScore = std::exchange(other.minScore, 0.0);
+                maxScore = std::exchange(other.maxScore, 0.0);
+                gradeCounts = std::exchange(other.gradeCounts, {});
+                fenwick = std::move(other.fenwick);
+                other.fenwick.clear();
+            }
+            return *this;
+        }
+
+        void add(double score, Grade grade) {
+            if (fenwick.empty()) {
+                fenwick.assign(BUCKETS + 1, 0);
+            }
+            if (count == 0) {
+                minScore = maxScore = score;
+            } else {
+                minScore = std::min(minScore, score);
+                maxScore = std::max(maxScore, score);
+            }
+            count++;
+            sum += score;
+            sumSquares += score * score;
+            gradeCounts[static_cast<size_t>(grade)]++;
+            for (size_t i = bucketOf(score) + 1; i <= BUCKETS; i += i & (~i + 1)) {
+                fenwick[i]++;
+            }
+        }
+
+        double mean() const {
+            return count == 0 ? 0.0 : sum / count;
+        }
+
+        ScoreSummary summary() const {
+            ScoreSummary result;
+            result.count = count;
+            result.mean = mean();
+            if (count > 0) {
+                double variance = sumSquares / count - result.mean * result.mean;
+                result.standardDeviation = std::sqrt(std::max(0.0, variance));
+            }
+            result.minScore = minScore;
+            result.maxScore = maxScore;
+            result.gradeCounts = gradeCounts;
+            return result;
+        }
+
+        size_t gradeCount(Grade grade) const {
+            return gradeCounts[static_cast<size_t>(grade)];
+        }
+
+        // p 백분위수 (최근접 순위 방식: 정렬했을 때 ceil(p/100 * n)번째 점수)
+        std::optional<double> percentile(double p) const {
+            if (count == 0 || p < 0.0 || p > 100.0) {
+                return std::nullopt;
+            }
+            uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * count)));
+            // 누적 개수가 rank 이상이 되는 첫 구간을 트리를 따라 내려가며 찾는다
+            size_t pos = 0;
+            for (size_t step = std::bit_floor(BUCKETS); step > 0; step >>= 1) {
+                if (pos + step <= BUCKETS && fenwick[pos + step] < rank) {
+                    pos += step;
+                    rank -= fenwick[pos];
+                }
+            }
+            return static_cast<double>(pos) / RESOLUTION;
+        }
+    };
+
+    class StudentManager {
+    private:
+        vector<string> studentNames;
+        vector<double> studentScores;
+        NameIndex nameIndex;
+        ScoreStatistics statistics;
+        std::optional<size_t> maxCapacity;   // nullopt이면 제한 없음
+
+        bool isValidScore(double score) const {
+            return score >= 0.0 && score <= 100.0;
+        }
+
+        bool isFull() const {
+            return maxCapacity && studentNames.size() >= *maxCapacity;
+        }
+
+        // 분기 없는 등급 계산: 비교 결과(0 또는 1)를 더한다
+        static Grade calculateGrade(double score) {
+            int passed = 0;
+            for (double threshold : GRADE_THRESHOLDS) {
+                passed += score >= threshold;
+            }
+            return static_cast<Grade>(static_cast<int>(GRADE_COUNT) - 1 - passed);
+        }
+
+        // 검증이 끝난 학생을 색인과 열에 추가. 중복이면 false
+        template<typename Name>
+        bool insertValidated(Name&& name, double score) {
+            uint32_t row = static_cast<uint32_t>(studentNames.size());
+            if (nameIndex.findOrInsert(name, row, studentNames)) {
+                return false;
+            }
+            studentNames.push_back(std::forward<Name>(name));
+            studentScores.push_back(score);
+            statistics.add(score, calculateGrade(score));
+            return true;
+        }
+
+    public:
+        explicit StudentManager(std::optional<size_t> capacity = std::nullopt)
+            : maxCapacity(capacity) {
+            if (maxCapacity) {
+                studentNames.reserve(*maxCapacity);
+                studentScores.reserve(*maxCapacity);
+                nameIndex.reserve(*maxCapacity);
+            }
+        }
+
+        StudentManager(const StudentManager&) = delete;
+        StudentManager& operator=(const StudentManager&) = delete;
+
+        StudentManager(StudentManager&& other) noexcept
+            : studentNames(std::move(other.studentNames)),
+              studentScores(std::move(other.studentScores)),
+              nameIndex(std::move(other.nameIndex)),
+              statistics(std::move(other.statistics)),
+              maxCapacity(other.maxCapacity) {}
+
+        bool addStudent(const string& name, double score) {
+            if (name.empty()) {
+                cout << "오류: 학생 이름이 비어있습니다." << endl;
+                return false;
+            }
+
+            if (!isValidScore(score)) {
+                cout << "오류: 점수는 0-100 사이여야 합니다." << endl;
+                return false;
+            }
+
+            if (isFull()) {
+                cout << "오류: 최대 수용 인원을 초과했습니다." << endl;
+                return false;
+            }
+
+            // 중복 검사: 해시 색인으로 평균 O(1)
+            if (!insertValidated(name, score)) {
+                cout << "경고: 이미 존재하는 학생입니다: " << name << endl;
+                return false;
+            }
+            return true;
+        }
+
+        // 일괄 추가: 검증과 중복 제거를 한 번의 순회로 처리 (같은 이름은 처음 것만 추가)
+        BulkAddResult addStudents(std::span<const StudentRecord> records) {
+            BulkAddResult result;
+            size_t expected = studentNames.size() + records.size();
+            if (maxCapacity) expected = std::min(expected, *maxCapacity);
+            if (expected > studentNames.capacity()) {
+                // 작은 묶음을 여러 번 추가해도 재할당이 O(1) 분할 상환이 되도록 두 배 이상으로
+                expected = std::max(expected, studentNames.capacity() * 2);
+                studentNames.reserve(expected);
+                studentScores.reserve(expected);
+            }
+            nameIndex.reserve(expected);
+
+            for (const StudentRecord& record : records) {
+                if (record.name.empty()) {
+                    result.emptyName++;
+                } else if (!isValidScore(record.score)) {
+                    result.invalidScore++;
+                } else if (isFull()) {
+                    result.overCapacity++;
+                } else if (insertValidated(record.name, record.score)) {
+                    result.added++;
+                } else {
+                    result.duplicate++;
+                }
+            }
+            return result;
+        }
+
+        // 이름으로 점수 찾기
+        std::optional<double> findScore(string_view name) const {
+            if (auto row = nameIndex.find(name, studentNames)) {
+                return studentScores[*row];
+            }
+            return std::nullopt;
+        }
+
+        // 점수 배열을 한꺼번에 등급으로 분류 (grades는 scores와 크기가 같아야 함)
+        static void classifyGrades(std::span<const double> scores, std::span<Grade> grades) {
+            if (grades.size() < scores.size()) {
+                throw std::invalid_argument("classifyGrades: 결과 배열이 점수 배열보다 작습니다");
+            }
+            size_t i = 0;
+#if defined(__SSE2__)
+            // 비교 결과는 참이면 모든 비트가 1(정수로 -1)이므로, 더하면 -(넘은 기준 수)가 된다
+            for (; i + 2 <= scores.size(); i += 2) {
+                __m128d values = _mm_loadu_pd(scores.data() + i);
+                __m128i passed = _mm_setzero_si128();
+                for (double threshold : GRADE_THRESHOLDS) {
+                    __m128d mask = _mm_cmpge_pd(values, _mm_set1_pd(threshold));
+                    passed = _mm_add_epi64(passed, _mm_castpd_si128(mask));
+                }
+                __m128i index = _mm_add_epi64(_mm_set1_epi64x(GRADE_COUNT - 1), passed);
+                grades[i] = static_cast<Grade>(_mm_cvtsi128_si32(index));
+                grades[i + 1] = static_cast<Grade>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(index, index)));
+            }
+#endif
+            for (; i < scores.size(); i++) {
+                grades[i] = calculateGrade(scores[i]);
+            }
+        }
+
+        // 힙 할당 없이 출력: 줄들을 고정 버퍼에 만들어 한 번에 내보낸다
+        void displayAllStudents(std::ostream& out = cout) const {
+            out << "\n=== 학생 목록 (" << studentNames.size() << "명) ===\n";
+
+            constexpr size_t BATCH = 256;
+            constexpr size_t BUFFER_SIZE = 16 * 1024;
+            char buffer[BUFFER_SIZE];
+            size_t used = 0;
+            Grade grades[BATCH];
+
+            auto append = [&](string_view text) {
+                if (used + text.size() > BUFFER_SIZE) {
+                    out.write(buffer, static_cast<std::streamsize>(used));
+                    used = 0;
+                }
+                if (text.size() > BUFFER_SIZE) {  // 버퍼보다 긴 이름은 바로 쓴다
+                    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+                    return;
+                }
+                std::memcpy(buffer + used, text.data(), text.size());
+                used += text.size();
+            };
+
+            for (size_t first = 0; first < studentNames.size(); first += BATCH) {
+                size_t count = std::min(BATCH, studentNames.size() - first);
+                classifyGrades(std::span<const double>(studentScores).subspan(first, count), grades);
+
+                for (size_t k = 0; k < count; ++k) {
+                    size_t i = first + k;
+                    char number[32];
+                    // cout의 기본 출력(유효숫자 6자리)과 같은 모양
+                    auto rowEnd = std::to_chars(number, number + sizeof(number), i + 1).ptr;
+                    append(string_view(number, static_cast<size_t>(rowEnd - number)));
+                    append(". ");
+                    append(studentNames[i]);
+                    append(" - 점수: ");
+                    auto scoreEnd = std::to_chars(number, number + sizeof(number), studentScores[i],
+                                                  std::chars_format::general, 6).ptr;
+                    append(string_view(number, static_cast<size_t>(scoreEnd - number)));
+                    append(", 등급: ");
+                    append(gradeToString(grades[k]));
+                    append("\n");
+                }
+            }
+            out.write(buffer, static_cast<std::streamsize>(used));
+            out.flush();
+        }
+
+        // 추가할 때 갱신해 둔 합계를 사용하므로 O(1)
+        double getAverageScore() const {
+            return statistics.mean();
+        }
+
+        ScoreSummary getScoreSummary() const {
+            return statistics.summary();
+        }
+
+        std::optional<double> getPercentile(double p) const {
+            return statistics.percentile(p);
+        }
+
+        std::optional<double> getMedian() const {
+            return statistics.percentile(50.0);
+        }
+
+        size_t getGradeCount(Grade grade) const {
+            return statistics.gradeCount(grade);
+        }
+
+        size_t getStudentCount() const {
+            return studentNames.size();
+        }
+
+        size_t indexMemoryBytes() const {
+            return nameIndex.memoryBytes();
+        }
+
+        // 정적 표를 가리키므로 호출할 때마다 string을 만들지 않는다
+        static string_view gradeToString(Grade grade) {
+            size_t index = static_cast<size_t>(grade);
+            return index < GRADE_COUNT ? GRADE_NAMES[index] : "Unknown";
+        }
+    };
+
+} // namespace MyProject
+
+// 출력 중 힙 할당 횟수를 세기 위한 전역 operator new 교체
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 중복 약 1%, 잘못된 점수 약 0.1%가 섞인 명단
+vector<MyProject::StudentRecord> makeRoster(size_t count) {
+    vector<MyProject::StudentRecord> roster;
+    roster.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        size_t id = (i % 100 == 99) ? i / 2 : i;          // 앞에서 나온 번호를 다시 사용
+        double score = (i % 1000 == 7) ? 120.0 : static_cast<double>((i * 37) % 1001) / 10.0;
+        roster.push_back({"학생" + std::to_string(id), score});
+    }
+    return roster;
+}
+
+// 08_coding_standards.cpp의 방식: std::find로 중복 검사
+size_t loadWithLinearSearch(const vector<MyProject::StudentRecord>& roster) {
+    vector<string> names;
+    vector<double> scores;
+    for (const auto& record : roster) {
+        if (record.name.empty() || record.score < 0.0 || record.score > 100.0) continue;
+        if (std::find(names.begin(), names.end(), record.name) == names.end()) {
+            names.push_back(record.name);
+            scores.push_back(record.score);
+        }
+    }
+    return names.size();
+}
+
+void demonstrateIndexedManager() {
+    using namespace MyProject;
+
+    cout << "=== 해시 색인 StudentManager ===" << endl;
+    auto manager = std::make_unique<StudentManager>(5);
+
+    const vector<std::pair<string, double>> testStudents = {
+        {"김철수", 95.5},
+        {"이영희", 87.3},
+        {"박민수", 92.0},
+        {"최정화", 78.8}
+    };
+
+    for (const auto& [name, score] : testStudents) {
+        manager->addStudent(name, score);
+    }
+
+    manager->displayAllStudents();
+    cout << "\n평균 점수: " << manager->getAverageScore() << endl;
+    cout << "이영희 점수: " << manager->findScore("이영희").value_or(-1) << endl;
+
+    cout << "\n=== 오류 처리 테스트 ===" << endl;
+    manager->addStudent("", 90);         // 빈 이름
+    manager->addStudent("홍길동", 150);  // 잘못된 점수
+    manager->addStudent("김철수", 80);   // 중복 이름
+    manager->addStudent("정수진", 85);   // 5번째: 성공
+    manager->addStudent("한지민", 91);   // 용량 초과
+
+    cout << "\n=== 일괄 추가 (제한 없음) ===" << endl;
+    StudentManager unlimited;
+    const vector<StudentRecord> batch = {
+        {"김철수", 95.5}, {"이영희", 87.3}, {"", 70.0}, {"박민수", -3.0},
+        {"김철수", 60.0}, {"최정화", 78.8}, {"이영희", 99.0}
+    };
+    BulkAddResult result = unlimited.addStudents(batch);
+    cout << "추가 " << result.added << "명, 빈 이름 " << result.emptyName
+         << ", 잘못된 점수 " << result.invalidScore << ", 중복 " << result.duplicate << endl;
+    cout << "김철수 점수 (처음 값 유지): " << unlimited.findScore("김철수").value_or(-1) << endl;
+
+    cout << "\n=== 용량 제한이 있는 일괄 추가 ===" << endl;
+    StudentManager limited(MAX_STUDENTS);
+    result = limited.addStudents(makeRoster(150));
+    cout << "추가 " << result.added << "명, 용량 초과 " << result.overCapacity
+         << ", 거부 합계 " << result.rejected() << endl;
+}
+
+void benchmarkLoading() {
+    using namespace MyProject;
+
+    cout << "\n=== 벤치마크: std::find 방식과 비교 (ms) ===" << endl;
+    for (size_t n : {5000, 10000, 20000}) {
+        auto roster = makeRoster(n);
+        size_t linearCount = 0;
+        double linearMs = measureMs([&] { linearCount = loadWithLinearSearch(roster); });
+        StudentManager manager;
+        double indexedMs = measureMs([&] { manager.addStudents(roster); });
+        cout << n << "명 - std::find: " << linearMs << ", 해시 색인: " << indexedMs
+             << (linearCount == manager.getStudentCount() ? "" : "  <-- 결과 불일치") << endl;
+    }
+
+    cout << "\n=== 벤치마크: 대용량 일괄 추가 (1명당 시간이 일정하면 선형) ===" << endl;
+    for (size_t n : {1000000, 2000000, 5000000, 10000000}) {
+        auto roster = makeRoster(n);
+        StudentManager manager;
+        BulkAddResult result;
+        double ms = measureMs([&] { result = manager.addStudents(roster); });
+        cout << n << "명: " << ms << " ms (" << ms * 1e6 / n << " ns/명), 추가 " << result.added
+             << ", 중복 " << result.duplicate << ", 잘못된 점수 " << result.invalidScore
+             << ", 색인 " << manager.indexMemoryBytes() / (1024 * 1024) << " MB" << endl;
+    }
+}
+
+void demonstrateStatistics() {
+    using namespace MyProject;
+
+    cout << "\n=== 증분 통계 ===" << endl;
+    StudentManager manager;
+    manager.addStudents(vector<StudentRecord>{
+        {"김철수", 95.5}, {"이영희", 87.3}, {"박민수", 92.0}, {"최정화", 78.8}, {"정수진", 64.0}
+    });
+
+    ScoreSummary summary = manager.getScoreSummary();
+    cout << "학생 " << summary.count << "명, 평균 " << summary.mean
+         << ", 표준편차 " << summary.standardDeviation
+         << ", 최저 " << summary.minScore << ", 최고 " << summary.maxScore << endl;
+    cout << "중앙값: " << manager.getMedian().value_or(-1)
+         << ", 90 백분위수: " << manager.getPercentile(90).value_or(-1) << endl;
+    cout << "등급별 인원:";
+    for (size_t g = 0; g < GRADE_COUNT; g++) {
+        cout << " " << StudentManager::gradeToString(static_cast<Grade>(g)) << "=" << summary.gradeCounts[g];
+    }
+    cout << endl;
+
+    // 옮겨진 객체는 빈 명단이 되어 다시 사용할 수 있다
+    StudentManager moved(std::move(manager));
+    manager.addStudent("홍길동", 60.0);
+    cout << "이동 후 - 새 객체 " << moved.getScoreSummary().count << "명, 옮겨진 객체 "
+         << manager.getScoreSummary().count << "명 (중앙값 " << manager.getMedian().value_or(-1) << ")" << endl;
+
+    cout << "\n=== 백분위수 정확도 (100만 명, 정렬한 결과와 비교) ===" << endl;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> anyScore(0.0, 100.0);
+    for (bool oneDecimal : {true, false}) {
+        vector<StudentRecord> records;
+        records.reserve(1000000);
+        for (size_t i = 0; i < 1000000; i++) {
+            double score = anyScore(rng);
+            if (oneDecimal) score = std::round(score * 10.0) / 10.0;
+            records.push_back({"학생" + std::to_string(i), score});
+        }
+        StudentManager large;
+        large.addStudents(records);
+
+        vector<double> sorted;
+        for (const auto& r : records) sorted.push_back(r.score);
+        std::sort(sorted.begin(), sorted.end());
+
+        double maxError = 0.0;
+        for (double p : {0.1, 1.0, 10.0, 25.0, 50.0, 75.0, 90.0, 99.0, 99.9, 100.0}) {
+            size_t rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(p / 100.0 * sorted.size())));
+            maxError = std::max(maxError, std::abs(sorted[rank - 1] - *large.getPercentile(p)));
+        }
+        cout << (oneDecimal ? "소수 첫째 자리 점수" : "임의의 실수 점수") << ": 최대 오차 " << maxError << "점" << endl;
+    }
+
+    cout << "\n=== 벤치마크: 대시보드 조회 1회당 시간 (100만 명, 마이크로초) ===" << endl;
+    auto roster = makeRoster(1000000);
+    StudentManager large;
+    large.addStudents(roster);
+    vector<double> scores;
+    for (const auto& r : roster) {
+        if (r.score <= 100.0) scores.push_back(r.score);
+    }
+
+    double sink = 0.0;
+    const int polls = 20;
+    double scanMs = measureMs([&] {
+        for (int i = 0; i < polls; i++) {
+            double sum = 0.0;
+            for (double score : scores) sum += score;  // 원래 getAverageScore
+            sink += sum / scores.size();
+        }
+    });
+    double incrementalMs = measureMs([&] {
+        for (int i = 0; i < polls * 1000; i++) sink += large.getAverageScore();
+    });
+    double nthMs = measureMs([&] {
+        for (int i = 0; i < polls; i++) {
+            vector<double> copy = scores;  // 정렬 없이 중앙값: 복사 + nth_element
+            std::nth_element(copy.begin(), copy.begin() + copy.size() / 2, copy.end());
+            sink += copy[copy.size() / 2];
+        }
+    });
+    double fenwickMs = measureMs([&] {
+        for (int i = 0; i < polls * 1000; i++) sink += *large.getPercentile(50.0);
+    });
+    cout << "평균 - 전체 순회: " << scanMs * 1000 / polls
+         << ", 증분 합계: " << incrementalMs * 1000 / (polls * 1000) << endl;
+    cout << "중앙값 - nth_element: " << nthMs * 1000 / polls
+         << ", 펜윅 트리: " << fenwickMs * 1000 / (polls * 1000) << endl;
+    cout << "(결과 확인용: " << sink << ")" << endl;
+}
+
+// ---------- 08_coding_standards.cpp의 원래 방식 (비교용) ----------
+MyProject::Grade legacyCalculateGrade(double score) {
+    using MyProject::Grade;
+    if (score >= 97.0) return Grade::A_PLUS;
+    if (score >= 93.0) return Grade::A;
+    if (score >= 90.0) return Grade::B_PLUS;
+    if (score >= 87.0) return Grade::B;
+    if (score >= 83.0) return Grade::C_PLUS;
+    if (score >= 80.0) return Grade::C;
+    if (score >= 70.0) return Grade::D;
+    return Grade::F;
+}
+
+string legacyGradeToString(MyProject::Grade grade) {
+    return string(MyProject::StudentManager::gradeToString(grade));  // 호출마다 string 생성
+}
+
+void legacyDisplay(const vector<string>& names, const vector<double>& scores, std::ostream& out) {
+    out << "\n=== 학생 목록 (" << names.size() << "명) ===" << endl;
+    for (size_t i = 0; i < names.size(); ++i) {
+        MyProject::Grade grade = legacyCalculateGrade(scores[i]);
+        out << (i + 1) << ". " << names[i]
+            << " - 점수: " << scores[i]
+            << ", 등급: " << legacyGradeToString(grade) << endl;
+    }
+}
+
+// 출력된 내용을 버리면서 바이트 수만 세는 스트림 버퍼
+class CountingBuffer : public std::streambuf {
+public:
+    size_t bytes = 0;
+
+protected:
+    int overflow(int c) override {
+        bytes++;
+        return c;
+    }
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        bytes += static_cast<size_t>(n);
+        return n;
+    }
+};
+
+void demonstrateClassification() {
+    using namespace MyProject;
+
+    cout << "\n=== 표 기반 등급 분류 ===" << endl;
+    vector<double> probes;
+    for (int i = 0; i <= 100000; i++) probes.push_back(i / 1000.0);
+    for (double t : GRADE_THRESHOLDS) {
+        probes.push_back(t);
+        probes.push_back(std::nextafter(t, 0.0));  // 기준 바로 아래
+    }
+    vector<Grade> grades(probes.size());
+    StudentManager::classifyGrades(probes, grades);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < probes.size(); i++) {
+        mismatches += grades[i] != legacyCalculateGrade(probes[i]);
+    }
+    cout << probes.size() << "개 점수 (기준 경계 포함), if 사슬과 다른 결과: " << mismatches << "개" << endl;
+    cout << "96.9 → " << StudentManager::gradeToString(grades[96900])
+         << ", 97.0 → " << StudentManager::gradeToString(grades[97000]) << endl;
+
+    cout << "\n=== 벤치마크: 점수 1000만 개 분류 (ms) ===" << endl;
+    vector<double> scores(10000000);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> anyScore(0.0, 100.0);
+    for (double& score : scores) score = anyScore(rng);
+    vector<Grade> legacyGrades(scores.size()), batchGrades(scores.size());
+
+    double legacyMs = measureMs([&] {
+        for (size_t i = 0; i < scores.size(); i++) legacyGrades[i] = legacyCalculateGrade(scores[i]);
+    });
+    double batchMs = measureMs([&] { StudentManager::classifyGrades(scores, batchGrades); });
+    cout << "if 사슬: " << legacyMs << ", classifyGrades: " << batchMs
+         << (legacyGrades == batchGrades ? " (결과 일치)" : " (결과 불일치)") << endl;
+
+    cout << "\n=== 벤치마크: 100만 줄 출력 ===" << endl;
+    auto roster = makeRoster(1000000);
+    StudentManager manager;
+    manager.addStudents(roster);
+    vector<string> names;
+    vector<double> rosterScores;
+    {
+        StudentManager check;  // 같은 학생을 같은 순서로 담기 위해 같은 검증을 거친다
+        for (const auto& r : roster) {
+            if (r.score <= 100.0 && !check.findScore(r.name)) {
+                check.addStudents(std::span<const StudentRecord>(&r, 1));
+                names.push_back(r.name);
+                rosterScores.push_back(r.score);
+            }
+        }
+    }
+
+    // 앞 1000명으로 출력 내용이 글자 단위로 같은지 확인
+    {
+        StudentManager small;
+        small.addStudents(std::span<const StudentRecord>(roster).first(1000));
+        std::ostringstream legacyText, newText;
+        size_t shown = small.getStudentCount();
+        legacyDisplay(vector<string>(names.begin(), names.begin() + shown),
+                      vector<double>(rosterScores.begin(), rosterScores.begin() + shown), legacyText);
+        small.displayAllStudents(newText);
+        cout << "출력 내용 일치 (" << shown << "줄): " << (legacyText.str() == newText.str() ? "예" : "아니오") << endl;
+    }
+
+    CountingBuffer legacyBuffer, newBuffer;
+    std::ostream legacyOut(&legacyBuffer), newOut(&newBuffer);
+    size_t before = allocationCount;
+    double legacyDisplayMs = measureMs([&] { legacyDisplay(names, rosterScores, legacyOut); });
+    size_t legacyAllocations = allocationCount - before;
+
+    before = allocationCount;
+    double newDisplayMs = measureMs([&] { manager.displayAllStudents(newOut); });
+    size_t newAllocations = allocationCount - before;
+
+    // 짧은 등급 문자열은 SSO 덕분에 원래 방식도 할당이 없을 수 있지만, 줄마다 endl로 비우는 비용이 크다
+    cout << "원래 방식: " << legacyDisplayMs << " ms, 할당 " << legacyAllocations << "번, " << legacyBuffer.bytes << "바이트" << endl;
+    cout << "새 방식:   " << newDisplayMs << " ms, 할당 " << newAllocations << "번, " << newBuffer.bytes << "바이트" << endl;
+}
+
+int main() {
+    try {
+        demonstrateIndexedManager();
+        demonstrateStatistics();
+        demonstrateClassification();
+        benchmarkLoading();
+    }
+    catch (const std::exception& e) {
+        cout << "예외 발생: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
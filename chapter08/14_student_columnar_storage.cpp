@@ -0,0 +1,573 @@
+/*
+ * StudentManager 열 기반 저장과 메모리 매핑
+ * 파일명: 14_student_columnar_storage.cpp
+ *
+ * 컴파일: g++ -std=c++20 -O2 -o 14_student_columnar_storage 14_student_columnar_storage.cpp
+ * 실행: ./14_student_columnar_storage (Linux/Mac)
+ */
+
+/*
+주제: 열 기반 파일 형식과 메모리 매핑 (Columnar Format & mmap Loading)
+정의: StudentManager(08_coding_standards.cpp, 13_scalable_student_manager.cpp)는 저장 기능이 없어
+      프로그램을 시작할 때마다 텍스트를 읽고 파싱하여 명단을 다시 만든다.
+      열 기반 파일로 저장해 두면 다시 열 때 mmap만 하면 되고, 파싱이나 복사 없이
+      바로 getAverageScore와 이름 검색에 답할 수 있다.
+
+핵심 개념: 열 기반 배치, 문자열 힙, 저장된 색인, 버전 헤더와 검증
+정의:
+- 파일 구성: [헤더][이름 오프셋 uint64 × (n+1)][점수 double × n][해시 색인 슬롯][이름 힙]
+  모든 배열이 8바이트 경계에 놓이므로 매핑한 주소를 그대로 배열로 사용한다
+- 문자열 힙: 이름들을 구분자 없이 이어 붙이고, i번째 이름은 offsets[i] ~ offsets[i+1] 구간이다
+- 저장된 색인: 13번 예제의 NameIndex 슬롯(행 번호 + 해시)을 그대로 저장하여, 열자마자
+  이름 검색이 가능하다. 파일에 남는 해시이므로 std::hash 대신 구현과 무관한 FNV-1a를 쓴다
+- 헤더: 매직, 버전, 바이트 순서 표식, 각 구역의 위치와 크기, 점수 합계, 체크섬을 담는다.
+  열 때는 O(1) 구조 검증(헤더 체크섬, 구역 경계)만 하고, 원하면 전체 데이터 체크섬도 확인한다
+- 저장은 12_atomic_file_replace.cpp와 같이 임시 파일 → fsync → rename 순서로 한다
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <chrono>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace MyProject {
+
+    // 파일 형식 오류 (잘못된 매직, 지원하지 않는 버전, 손상된 구역 등)
+    class ColumnarFormatException : public std::runtime_error {
+    public:
+        explicit ColumnarFormatException(const string& msg)
+            : std::runtime_error("열 기반 파일 오류: " + msg) {}
+    };
+
+    // 구현과 무관하게 항상 같은 값을 내는 해시 (FNV-1a)
+    inline uint32_t stableHash(string_view text) {
+        uint32_t hash = 2166136261u;
+        for (unsigned char c : text) {
+            hash = (hash ^ c) * 16777619u;
+        }
+        return hash;
+    }
+
+    inline uint64_t checksum(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ p[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // 이름 → 행 번호 색인 슬롯. 메모리와 파일에서 같은 모양이다
+    struct IndexSlot {
+        uint32_t row;
+        uint32_t hash;
+    };
+
+    const uint32_t EMPTY_ROW = UINT32_MAX;
+
+    inline size_t homeSlot(uint32_t hash, size_t slotCount) {
+        int shift = 32 - std::countr_zero(slotCount);
+        return static_cast<size_t>((hash * 0x9E3779B1u) >> shift);
+    }
+
+    // 슬롯 배열에서 이름 찾기 (메모리 색인과 매핑된 색인이 함께 사용)
+    template<typename NameAt>
+    std::optional<uint32_t> probeIndex(std::span<const IndexSlot> slots, string_view name, NameAt nameAt) {
+        if (slots.empty()) return std::nullopt;
+        uint32_t hash = stableHash(name);
+        size_t mask = slots.size() - 1;
+        for (size_t pos = homeSlot(hash, slots.size()), step = 0; step < slots.size(); pos = (pos + 1) & mask, step++) {
+            const IndexSlot& s = slots[pos];
+            if (s.row == EMPTY_ROW) return std::nullopt;
+            if (s.hash == hash && nameAt(s.row) == name) return s.row;
+        }
+        return std::nullopt;
+    }
+
+    // 파일 헤더 (리틀 엔디언 기준, 크기는 8의 배수)
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrderMark;    // 0x01020304: 다른 바이트 순서의 기계에서 만든 파일을 거부
+        uint64_t studentCount;
+        uint64_t indexSlotCount;   // 2의 거듭제곱
+        uint64_t offsetsPos;
+        uint64_t scoresPos;
+        uint64_t indexPos;
+        uint64_t heapPos;
+        uint64_t heapSize;
+        uint64_t fileSize;
+        double scoreSum;           // 열자마자 평균을 답하기 위한 합계
+        uint64_t dataChecksum;     // 헤더 뒤 모든 바이트의 체크섬
+        uint64_t headerChecksum;   // 이 필드를 0으로 두고 계산한 헤더 체크섬
+    };
+    static_assert(sizeof(FileHeader) % 8 == 0, "헤더 뒤 배열이 8바이트 경계에 놓여야 합니다");
+
+    constexpr char FILE_MAGIC[8] = {'S', 'T', 'U', 'D', 'C', 'O', 'L', '\0'};
+    const uint32_t FILE_VERSION = 1;
+    const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    struct StudentRecord {
+        string name;
+        double score;
+    };
+
+    // 메모리에서 명단을 만드는 쪽 (13번 예제의 StudentManager를 줄인 것)
+    class StudentManager {
+    private:
+        vector<string> studentNames;
+        vector<double> studentScores;
+        vector<IndexSlot> slots = vector<IndexSlot>(16, IndexSlot{EMPTY_ROW, 0});
+        double scoreSum = 0.0;
+
+        void growIndex() {
+            vector<IndexSlot> old = std::move(slots);
+            slots.assign(old.size() * 2, IndexSlot{EMPTY_ROW, 0});
+            size_t mask = slots.size() - 1;
+            for (const IndexSlot& s : old) {
+                if (s.row == EMPTY_ROW) continue;
+                size_t pos = homeSlot(s.hash, slots.size());
+                while (slots[pos].row != EMPTY_ROW) pos = (pos + 1) & mask;
+                slots[pos] = s;
+            }
+        }
+
+        static void writeAll(int fd, const void* data, size_t size, const string& filename) {
+            const char* p = static_cast<const char*>(data);
+            while (size > 0) {
+                ssize_t n = write(fd, p, size);
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::runtime_error("파일 쓰기 중 오류가 발생했습니다: " + filename);
+                }
+                p += n;
+                size -= static_cast<size_t>(n);
+            }
+        }
+
+        // mkstemp는 0600으로 만들므로, 교체 전에 기존 파일의 권한(없으면 0666 & ~umask)을 입힌다
+        static void copyPermissions(int fd, const string& filename, const string& tempName) {
+            struct stat st;
+            mode_t mode;
+            if (stat(filename.c_str(), &st) == 0) {
+                mode = st.st_mode & 07777;
+            } else {
+                mode_t mask = umask(0);  // umask는 읽기 전용 함수가 없어 설정 후 되돌린다
+                umask(mask);
+                mode = 0666 & ~mask;
+            }
+            if (fchmod(fd, mode) != 0) {
+                throw std::runtime_error("임시 파일 권한 설정 실패: " + tempName);
+            }
+        }
+
+    public:
+        bool addStudent(const string& name, double score) {
+            if (name.empty() || !(score >= 0.0 && score <= 100.0)) {
+                return false;
+            }
+            if ((studentNames.size() + 1) * 2 > slots.size()) {
+                growIndex();
+            }
+            uint32_t hash = stableHash(name);
+            size_t mask = slots.size() - 1;
+            size_t pos = homeSlot(hash, slots.size());
+            for (; slots[pos].row != EMPTY_ROW; pos = (pos + 1) & mask) {
+                if (slots[pos].hash == hash && studentNames[slots[pos].row] == name) {
+                    return false;  // 중복
+                }
+            }
+            slots[pos] = IndexSlot{static_cast<uint32_t>(studentNames.size()), hash};
+            studentNames.push_back(name);
+            studentScores.push_back(score);
+            scoreSum += score;
+            return true;
+        }
+
+        size_t addStudents(std::span<const StudentRecord> records) {
+            size_t added = 0;
+            for (const auto& r : records) added += addStudent(r.name, r.score);
+            return added;
+        }
+
+        std::optional<double> findScore(string_view name) const {
+            auto row = probeIndex(slots, name, [this](uint32_t r) { return string_view(studentNames[r]); });
+            if (row) return studentScores[*row];
+            return std::nullopt;
+        }
+
+        double getAverageScore() const {
+            return studentScores.empty() ? 0.0 : scoreSum / studentScores.size();
+        }
+
+        size_t getStudentCount() const {
+            return studentNames.size();
+        }
+
+        // 열 기반 파일로 저장: 임시 파일 → fsync → rename
+        void saveColumnar(const string& filename) const {
+            if (studentNames.size() >= EMPTY_ROW) {
+                throw std::length_error("학생 수가 파일 형식의 한도를 넘었습니다");
+            }
+
+            vector<uint64_t> offsets;
+            offsets.reserve(studentNames.size() + 1);
+            uint64_t heapSize = 0;
+            offsets.push_back(0);
+            for (const auto& name : studentNames) {
+                heapSize += name.size();
+                offsets.push_back(heapSize);
+            }
+
+            FileHeader header{};
+            std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+            header.version = FILE_VERSION;
+            header.byteOrderMark = BYTE_ORDER_MARK;
+            header.studentCount = studentNames.size();
+            header.indexSlotCount = slots.size();
+            header.offsetsPos = sizeof(FileHeader);
+            header.scoresPos = header.offsetsPos + offsets.size() * sizeof(uint64_t);
+            header.indexPos = header.scoresPos + studentScores.size() * sizeof(double);
+            header.heapPos = header.indexPos + slots.size() * sizeof(IndexSlot);
+            header.heapSize = heapSize;
+            header.fileSize = header.heapPos + heapSize;
+            header.scoreSum = scoreSum;
+
+            uint64_t data = checksum(offsets.data(), offsets.size() * sizeof(uint64_t));
+            data = checksum(studentScores.data(), studentScores.size() * sizeof(double), data);
+            data = checksum(slots.data(), slots.size() * sizeof(IndexSlot), data);
+            for (const auto& name : studentNames) data = checksum(name.data(), name.size(), data);
+            header.dataChecksum = data;
+            header.headerChecksum = checksum(&header, sizeof(header));
+
+            string tempName = filename + ".tmp.XXXXXX";
+            int fd = mkstemp(&tempName[0]);
+            if (fd < 0) {
+                throw std::runtime_error("임시 파일을 생성할 수 없습니다: " + tempName);
+            }
+            try {
+                writeAll(fd, &header, sizeof(header), tempName);
+                writeAll(fd, offsets.data(), offsets.size() * sizeof(uint64_t), tempName);
+                writeAll(fd, studentScores.data(), studentScores.size() * sizeof(double), tempName);
+                writeAll(fd, slots.data(), slots.size() * sizeof(IndexSlot), tempName);
+                // 이름 힙은 1MB씩 모아서 쓴다
+                string buffer;
+                for (const auto& name : studentNames) {
+                    buffer += name;
+                    if (buffer.size() >= (1u << 20)) {
+                        writeAll(fd, buffer.data(), buffer.size(), tempName);
+                        buffer.clear();
+                    }
+                }
+                writeAll(fd, buffer.data(), buffer.size(), tempName);
+                copyPermissions(fd, filename, tempName);
+                if (fsync(fd) != 0) {
+                    throw std::runtime_error("파일 동기화 실패: " + tempName);
+                }
+                close(fd);
+                fd = -1;
+                if (rename(tempName.c_str(), filename.c_str()) != 0) {
+                    throw std::runtime_error("파일 교체 실패: " + filename);
+                }
+            }
+            catch (...) {
+                if (fd >= 0) close(fd);
+                unlink(tempName.c_str());
+                throw;
+            }
+        }
+    };
+
+    // 열 기반 파일을 메모리 매핑으로 연 읽기 전용 명단
+    class MappedStudentRoster {
+    private:
+        void* mapping = MAP_FAILED;
+        size_t mappingSize = 0;
+        const FileHeader* header = nullptr;
+        std::span<const uint64_t> offsets;
+        std::span<const double> scores;
+        std::span<const IndexSlot> slots;
+        const char* heap = nullptr;
+
+        void fail(const string& message) const {
+            throw ColumnarFormatException(message);
+        }
+
+        // 구역 [pos, pos + count * elementSize)가 파일 안에 있는지 (곱셈 오버플로 포함)
+        bool sectionFits(uint64_t pos, uint64_t count, uint64_t elementSize) const {
+            if (pos > mappingSize || count > (mappingSize - pos) / elementSize) return false;
+            return true;
+        }
+
+        void validateStructure() {
+            if (mappingSize < sizeof(FileHeader)) fail("파일이 헤더보다 작습니다");
+            header = static_cast<const FileHeader*>(mapping);
+            if (std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) fail("매직 값이 다릅니다");
+            if (header->byteOrderMark != BYTE_ORDER_MARK) fail("바이트 순서가 다른 기계에서 만든 파일입니다");
+            if (header->version != FILE_VERSION) {
+                fail("지원하지 않는 버전입니다: " + std::to_string(header->version));
+            }
+
+            FileHeader copy = *header;
+            copy.headerChecksum = 0;
+            if (checksum(&copy, sizeof(copy)) != header->headerChecksum) fail("헤더 체크섬이 다릅니다");
+
+            uint64_t n = header->studentCount;
+            uint64_t slotCount = header->indexSlotCount;
+            if (header->fileSize != mappingSize) fail("파일 크기가 헤더와 다릅니다 (잘린 파일?)");
+            if (n >= EMPTY_ROW) fail("학생 수가 너무 큽니다");
+            if (slotCount < 2 || slotCount > (uint64_t(1) << 32) || !std::has_single_bit(slotCount) || slotCount < n) {
+                fail("색인 크기가 잘못되었습니다");
+            }
+            if (header->offsetsPos != sizeof(FileHeader) ||
+                header->scoresPos != header->offsetsPos + (n + 1) * sizeof(uint64_t) ||
+                header->indexPos != header->scoresPos + n * sizeof(double) ||
+                header->heapPos != header->indexPos + slotCount * sizeof(IndexSlot)) {
+                fail("구역 위치가 형식과 맞지 않습니다");
+            }
+            if (!sectionFits(header->offsetsPos, n + 1, sizeof(uint64_t)) ||
+                !sectionFits(header->scoresPos, n, sizeof(double)) ||
+                !sectionFits(header->indexPos, slotCount, sizeof(IndexSlot)) ||
+                !sectionFits(header->heapPos, header->heapSize, 1)) {
+                fail("구역이 파일 범위를 벗어납니다");
+            }
+
+            const char* base = static_cast<const char*>(mapping);
+            offsets = {reinterpret_cast<const uint64_t*>(base + header->offsetsPos), n + 1};
+            scores = {reinterpret_cast<const double*>(base + header->scoresPos), n};
+            slots = {reinterpret_cast<const IndexSlot*>(base + header->indexPos), slotCount};
+            heap = base + header->heapPos;
+            if (offsets.front() != 0 || offsets.back() != header->heapSize) fail("이름 오프셋 범위가 잘못되었습니다");
+        }
+
+    public:
+        enum class Verify {
+            Structure,   // O(1): 헤더와 구역 경계만 확인
+            Full         // O(파일 크기): 데이터 체크섬까지 확인
+        };
+
+        explicit MappedStudentRoster(const string& filename, Verify verify = Verify::Structure) {
+            int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                throw std::runtime_error("파일을 열 수 없습니다: " + filename);
+            }
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                close(fd);
+                throw std::runtime_error("파일 정보를 읽을 수 없습니다: " + filename);
+            }
+            mappingSize = static_cast<size_t>(st.st_size);
+            if (mappingSize > 0) {
+                mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            }
+            close(fd);  // 매핑은 파일 디스크립터를 닫아도 유지된다
+            if (mappingSize > 0 && mapping == MAP_FAILED) {
+                throw std::runtime_error("메모리 매핑 실패: " + filename);
+            }
+
+            try {
+                validateStructure();
+                if (verify == Verify::Full) {
+                    const char* base = static_cast<const char*>(mapping);
+                    if (checksum(base + sizeof(FileHeader), mappingSize - sizeof(FileHeader)) != header->dataChecksum) {
+                        fail("데이터 체크섬이 다릅니다");
+                    }
+                }
+            }
+            catch (...) {
+                if (mapping != MAP_FAILED) munmap(mapping, mappingSize);
+                throw;
+            }
+        }
+
+        ~MappedStudentRoster() {
+            if (mapping != MAP_FAILED) munmap(mapping, mappingSize);
+        }
+
+        MappedStudentRoster(const MappedStudentRoster&) = delete;
+        MappedStudentRoster& operator=(const MappedStudentRoster&) = delete;
+
+        size_t getStudentCount() const { return scores.size(); }
+
+        double getAverageScore() const {
+            return scores.empty() ? 0.0 : header->scoreSum / static_cast<double>(scores.size());
+        }
+
+        // 매핑된 힙을 가리키는 이름 (복사 없음). 구조 검증만 한 경우를 위해 구간을 확인한다
+        string_view getName(size_t row) const {
+            uint64_t begin = offsets[row], end = offsets[row + 1];
+            if (begin > end || end > header->heapSize) fail("이름 오프셋이 손상되었습니다: " + std::to_string(row));
+            return string_view(heap + begin, static_cast<size_t>(end - begin));
+        }
+
+        double getScore(size_t row) const { return scores[row]; }
+        std::span<const double> getScores() const { return scores; }
+
+        std::optional<double> findScore(string_view name) const {
+            auto row = probeIndex(slots, name, [this](uint32_t r) {
+                if (r >= scores.size()) fail("색인의 행 번호가 손상되었습니다");
+                return getName(r);
+            });
+            if (row) return scores[*row];
+            return std::nullopt;
+        }
+
+        size_t fileSize() const { return mappingSize; }
+    };
+
+} // namespace MyProject
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 지금까지의 시작 방식: "이름,점수" 텍스트를 읽어 명단을 다시 만든다
+void rebuildFromText(const string& filename, MyProject::StudentManager& manager) {
+    std::ifstream in(filename);
+    if (!in) {
+        throw std::runtime_error("파일을 열 수 없습니다: " + filename);
+    }
+    string line;
+    while (std::getline(in, line)) {
+        auto comma = line.find(',');
+        if (comma == string::npos) continue;
+        manager.addStudent(line.substr(0, comma), std::stod(line.substr(comma + 1)));
+    }
+}
+
+void corruptByte(const string& filename, off_t position) {
+    int fd = open(filename.c_str(), O_RDWR);
+    char c;
+    if (fd >= 0 && pread(fd, &c, 1, position) == 1) {
+        c ^= 0x5A;
+        if (pwrite(fd, &c, 1, position) != 1) cout << "파일 수정 실패" << endl;
+    }
+    if (fd >= 0) close(fd);
+}
+
+int main() {
+    using namespace MyProject;
+
+    try {
+        cout << "=== 저장하고 다시 열기 ===" << endl;
+        StudentManager manager;
+        const vector<StudentRecord> students = {
+            {"김철수", 95.5}, {"이영희", 87.3}, {"박민수", 92.0}, {"최정화", 78.8}
+        };
+        manager.addStudents(students);
+        manager.saveColumnar("students.col");
+
+        MappedStudentRoster roster("students.col", MappedStudentRoster::Verify::Full);
+        cout << "학생 " << roster.getStudentCount() << "명, 평균 " << roster.getAverageScore()
+             << ", 파일 크기 " << roster.fileSize() << "바이트" << endl;
+        for (size_t i = 0; i < roster.getStudentCount(); i++) {
+            cout << (i + 1) << ". " << roster.getName(i) << " - 점수: " << roster.getScore(i) << endl;
+        }
+        cout << "이영희 점수: " << roster.findScore("이영희").value_or(-1)
+             << ", 홍길동 등록됨? " << (roster.findScore("홍길동") ? "예" : "아니오") << endl;
+
+        cout << "\n=== 손상된 파일 검증 ===" << endl;
+        const std::pair<const char*, off_t> damages[] = {
+            {"헤더 (학생 수)", static_cast<off_t>(offsetof(FileHeader, studentCount))},
+            {"이름 힙", static_cast<off_t>(roster.fileSize() - 2)},
+        };
+        for (const auto& [label, position] : damages) {
+            manager.saveColumnar("damaged.col");
+            corruptByte("damaged.col", position);
+            for (auto verify : {MappedStudentRoster::Verify::Structure, MappedStudentRoster::Verify::Full}) {
+                try {
+                    MappedStudentRoster damaged("damaged.col", verify);
+                    cout << label << " 손상, " << (verify == MappedStudentRoster::Verify::Full ? "전체" : "구조")
+                         << " 검증: 통과 (데이터 손상은 전체 검증에서만 발견)" << endl;
+                }
+                catch (const ColumnarFormatException& e) {
+                    cout << label << " 손상, " << (verify == MappedStudentRoster::Verify::Full ? "전체" : "구조")
+                         << " 검증: " << e.what() << endl;
+                }
+            }
+        }
+        {
+            std::ofstream truncated("damaged.col", std::ios::binary);
+            truncated << "STUDCOL";
+        }
+        try {
+            MappedStudentRoster damaged("damaged.col");
+        }
+        catch (const ColumnarFormatException& e) {
+            cout << "잘린 파일: " << e.what() << endl;
+        }
+
+        cout << "\n=== 벤치마크: 학생 200만 명 시작 시간 (ms) ===" << endl;
+        const size_t count = 2000000;
+        {
+            std::ofstream text("students.txt");
+            for (size_t i = 0; i < count; i++) {
+                text << "학생" << i << "," << static_cast<double>((i * 37) % 1001) / 10.0 << "\n";
+            }
+        }
+
+        StudentManager fromText;
+        double textMs = measureMs([&] { rebuildFromText("students.txt", fromText); });
+        double saveMs = measureMs([&] { fromText.saveColumnar("students.col"); });
+
+        double average = 0.0;
+        std::optional<double> found;
+        double openMs = measureMs([&] {
+            MappedStudentRoster mapped("students.col");
+            average = mapped.getAverageScore();
+            found = mapped.findScore("학생1234567");
+        });
+        double verifiedOpenMs = measureMs([&] {
+            MappedStudentRoster mapped("students.col", MappedStudentRoster::Verify::Full);
+        });
+
+        MappedStudentRoster mapped("students.col");
+        size_t hits = 0;
+        double lookupMs = measureMs([&] {
+            for (size_t i = 0; i < 100000; i++) {
+                hits += mapped.findScore("학생" + std::to_string((i * 7919) % count)).has_value();
+            }
+        });
+
+        cout << "텍스트 파싱으로 재구성: " << textMs << endl;
+        cout << "열 기반 파일 저장: " << saveMs << " (" << mapped.fileSize() / (1024 * 1024) << " MB)" << endl;
+        cout << "매핑으로 열기 + 평균 + 검색 1번: " << openMs
+             << " (평균 " << average << ", 학생1234567 = " << found.value_or(-1) << ")" << endl;
+        cout << "전체 체크섬 검증 포함 열기: " << verifiedOpenMs << endl;
+        cout << "매핑된 파일에서 검색 10만 번: " << lookupMs << " (찾음 " << hits << ")" << endl;
+        cout << "평균 일치: " << (average == fromText.getAverageScore() ? "예" : "아니오") << endl;
+
+        unlink("students.txt");
+        unlink("students.col");
+        unlink("damaged.col");
+    }
+    catch (const std::exception& e) {
+        cout << "예외 발생: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
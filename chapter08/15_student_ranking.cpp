@@ -0,0 +1,309 @@
+/*
+ * StudentManager 순위 계산
+ * 파일명: 15_student_ranking.cpp
+ *
+ * 컴파일: g++ -std=c++20 -O2 -pthread -o 15_student_ranking 15_student_ranking.cpp
+ * 실행: ./15_student_ranking (Linux/Mac) 또는 15_student_ranking.exe (Windows)
+ */
+
+/*
+주제: 순위 계산 엔진 (Ranking Engine)
+정의: 수백만 명 명단에서 상위 K명이나 전체 순위를 구할 때, (점수, 이름) 쌍으로 복사한 뒤
+      한 스레드에서 std::sort를 하면 복사 비용과 정렬 시간이 모두 크다.
+      RankingEngine은 StudentManager의 studentNames/studentScores 열을 그대로 참조하고,
+      결과로 행 번호의 순열(permutation)만 만든다.
+
+핵심 개념: 순위 규칙, 힙 기반 상위 K, 기수 정렬, 병렬 병합
+정의:
+- 순위 규칙: 점수가 높은 순, 점수가 같으면 이름 순, 이름도 같으면 행 번호 순 (결과가 항상 하나로 정해짐)
+- 상위 K: 크기 K인 힙에 "지금까지의 K등"을 두고 더 나은 학생이 오면 교체한다. O(n log K)
+- 기수 정렬: double 점수를 크기 순서가 보존되는 64비트 정수 키로 바꾸어 8비트씩 정렬한다.
+  모든 키에서 같은 자리(예: 지수 부분)는 건너뛴다. 같은 점수 구간은 이름으로 다시 정렬한다
+- 병렬 병합: 배열을 스레드 수만큼 나누어 각자 정렬한 뒤, 두 개씩 병합하는 단계를 반복한다
+*/
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <array>
+#include <thread>
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <cstdint>
+#include <chrono>
+#include <random>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace MyProject {
+
+    class RankingEngine {
+    private:
+        std::span<const string> studentNames;
+        std::span<const double> studentScores;
+
+        // 정렬할 항목: 키와 행 번호 (이름과 점수는 복사하지 않는다)
+        struct Entry {
+            uint64_t key;
+            uint32_t row;
+        };
+
+        // 키가 같을 때는 이름, 이름도 같으면 행 번호로 비교
+        bool entryBefore(const Entry& a, const Entry& b) const {
+            if (a.key != b.key) return a.key < b.key;
+            int order = studentNames[a.row].compare(studentNames[b.row]);
+            if (order != 0) return order < 0;
+            return a.row < b.row;
+        }
+
+        // 한 구간을 기수 정렬 (buffer는 같은 크기의 작업 공간)
+        void radixSort(std::span<Entry> entries, std::span<Entry> buffer) const {
+            std::array<std::array<size_t, 256>, 8> counts{};
+            for (const Entry& e : entries) {
+                for (int pass = 0; pass < 8; pass++) {
+                    counts[pass][(e.key >> (pass * 8)) & 0xFF]++;
+                }
+            }
+
+            Entry* from = entries.data();
+            Entry* to = buffer.data();
+            for (int pass = 0; pass < 8; pass++) {
+                auto& count = counts[pass];
+                // 모든 키의 이 자리가 같으면 순서가 바뀌지 않으므로 건너뛴다
+                if (std::find(count.begin(), count.end(), entries.size()) != count.end()) continue;
+
+                size_t position = 0;
+                for (size_t& c : count) {
+                    size_t n = c;
+                    c = position;
+                    position += n;
+                }
+                for (size_t i = 0; i < entries.size(); i++) {
+                    to[count[(from[i].key >> (pass * 8)) & 0xFF]++] = from[i];
+                }
+                std::swap(from, to);
+            }
+            if (from != entries.data()) {
+                std::copy(from, from + entries.size(), entries.data());
+            }
+
+            // 같은 점수 구간은 이름 순으로 (기수 정렬은 안정적이므로 구간 안은 행 번호 순이다)
+            for (size_t first = 0; first < entries.size();) {
+                size_t last = first + 1;
+                while (last < entries.size() && entries[last].key == entries[first].key) last++;
+                if (last - first > 1) {
+                    std::sort(entries.begin() + first, entries.begin() + last,
+                              [this](const Entry& a, const Entry& b) { return entryBefore(a, b); });
+                }
+                first = last;
+            }
+        }
+
+        template<typename Work>
+        static void runParallel(unsigned threadCount, Work work) {
+            vector<std::thread> workers;
+            for (unsigned t = 1; t < threadCount; t++) {
+                workers.emplace_back(work, t);
+            }
+            work(0u);
+            for (auto& w : workers) w.join();
+        }
+
+    public:
+        RankingEngine(std::span<const string> names, std::span<const double> scores)
+            : studentNames(names), studentScores(scores) {
+            if (names.size() != scores.size()) {
+                throw std::invalid_argument("이름 열과 점수 열의 크기가 다릅니다");
+            }
+            if (names.size() >= UINT32_MAX) {
+                throw std::length_error("행 번호는 32비트 범위여야 합니다");
+            }
+        }
+
+        // 점수 내림차순이 되도록 double을 부호 없는 정수 키로 변환
+        static uint64_t scoreKey(double score) {
+            if (score == 0.0) score = 0.0;  // -0.0과 0.0을 같은 키로
+            uint64_t bits = std::bit_cast<uint64_t>(score);
+            const uint64_t SIGN = uint64_t(1) << 63;
+            uint64_t ascending = (bits & SIGN) ? ~bits : (bits | SIGN);
+            return ~ascending;
+        }
+
+        // a가 b보다 앞 순위인가
+        bool ranksBefore(uint32_t a, uint32_t b) const {
+            if (studentScores[a] != studentScores[b]) return studentScores[a] > studentScores[b];
+            int order = studentNames[a].compare(studentNames[b]);
+            if (order != 0) return order < 0;
+            return a < b;
+        }
+
+        // 상위 k명의 행 번호 (1등부터)
+        vector<uint32_t> topK(size_t k) const {
+            k = std::min(k, studentScores.size());
+            vector<uint32_t> heap;
+            heap.reserve(k);
+            if (k == 0) return heap;
+
+            // 힙의 맨 위는 "지금까지의 k등" (가장 뒤 순위)
+            auto worseOnTop = [this](uint32_t a, uint32_t b) { return ranksBefore(a, b); };
+            for (uint32_t row = 0; row < studentScores.size(); row++) {
+                if (heap.size() < k) {
+                    heap.push_back(row);
+                    std::push_heap(heap.begin(), heap.end(), worseOnTop);
+                } else if (ranksBefore(row, heap.front())) {
+                    std::pop_heap(heap.begin(), heap.end(), worseOnTop);
+                    heap.back() = row;
+                    std::push_heap(heap.begin(), heap.end(), worseOnTop);
+                }
+            }
+            std::sort_heap(heap.begin(), heap.end(), worseOnTop);  // 앞 순위부터 정렬됨
+            return heap;
+        }
+
+        // 전체 순위: 구간별 기수 정렬 후 병렬 병합
+        vector<uint32_t> fullRanking(unsigned threadCount = std::max(1u, std::thread::hardware_concurrency())) const {
+            size_t n = studentScores.size();
+            threadCount = static_cast<unsigned>(std::clamp<size_t>(threadCount, 1, std::max<size_t>(1, n / 4096)));
+
+            vector<Entry> entries(n), buffer(n);
+            vector<size_t> bounds(threadCount + 1);
+            for (unsigned t = 0; t <= threadCount; t++) bounds[t] = n * t / threadCount;
+
+            runParallel(threadCount, [&](unsigned t) {
+                for (size_t i = bounds[t]; i < bounds[t + 1]; i++) {
+                    entries[i] = Entry{scoreKey(studentScores[i]), static_cast<uint32_t>(i)};
+                }
+                size_t first = bounds[t], length = bounds[t + 1] - bounds[t];
+                radixSort(std::span<Entry>(entries).subspan(first, length),
+                          std::span<Entry>(buffer).subspan(first, length));
+            });
+
+            // 정렬된 구간을 두 개씩 병합 (단계마다 구간 수가 절반)
+            auto before = [this](const Entry& a, const Entry& b) { return entryBefore(a, b); };
+            while (bounds.size() > 2) {
+                size_t pairs = (bounds.size() - 1) / 2;
+                vector<size_t> merged;
+                for (size_t p = 0; p < bounds.size(); p += 2) merged.push_back(bounds[p]);
+                if (merged.back() != bounds.back()) merged.push_back(bounds.back());
+
+                runParallel(static_cast<unsigned>(merged.size() - 1), [&](unsigned m) {
+                    size_t first = bounds[2 * m];
+                    if (m < pairs) {
+                        std::merge(entries.begin() + bounds[2 * m], entries.begin() + bounds[2 * m + 1],
+                                   entries.begin() + bounds[2 * m + 1], entries.begin() + bounds[2 * m + 2],
+                                   buffer.begin() + first, before);
+                    } else {  // 짝이 없는 마지막 구간은 그대로 옮긴다
+                        std::copy(entries.begin() + first, entries.end(), buffer.begin() + first);
+                    }
+                });
+                entries.swap(buffer);
+                bounds = std::move(merged);
+            }
+
+            vector<uint32_t> ranking(n);
+            for (size_t i = 0; i < n; i++) ranking[i] = entries[i].row;
+            return ranking;
+        }
+    };
+
+} // namespace MyProject
+
+template<typename Func>
+double measureMs(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    using namespace MyProject;
+
+    try {
+        cout << "=== 작은 명단의 순위 ===" << endl;
+        vector<string> studentNames = {"김철수", "이영희", "박민수", "최정화", "강하늘", "윤서연"};
+        vector<double> studentScores = {95.5, 87.3, 92.0, 87.3, 95.5, 78.8};
+        RankingEngine engine(studentNames, studentScores);
+
+        vector<uint32_t> ranking = engine.fullRanking();
+        for (size_t rank = 0; rank < ranking.size(); rank++) {
+            uint32_t row = ranking[rank];
+            cout << (rank + 1) << "등: " << studentNames[row] << " (" << studentScores[row] << "점, 행 " << row << ")" << endl;
+        }
+        cout << "상위 3명:";
+        for (uint32_t row : engine.topK(3)) cout << " " << studentNames[row];
+        cout << endl;
+
+        cout << "\n=== 대용량 명단 (300만 명, 점수는 0.1점 단위라 동점자가 많음) ===" << endl;
+        const size_t count = 3000000;
+        studentNames.clear();
+        studentScores.clear();
+        studentNames.reserve(count);
+        studentScores.reserve(count);
+        std::mt19937 rng(17);
+        for (size_t i = 0; i < count; i++) {
+            studentNames.push_back("학생" + std::to_string(rng() % 100000000));  // 이름 순서와 행 순서가 무관
+            studentScores.push_back(static_cast<double>(rng() % 1001) / 10.0);
+        }
+        RankingEngine large(studentNames, studentScores);
+
+        // 기준: 행 번호를 같은 규칙으로 std::sort
+        vector<uint32_t> expected(count);
+        for (uint32_t i = 0; i < count; i++) expected[i] = i;
+        double indexSortMs = measureMs([&] {
+            std::sort(expected.begin(), expected.end(),
+                      [&](uint32_t a, uint32_t b) { return large.ranksBefore(a, b); });
+        });
+
+        // 지금까지의 방식: (점수, 이름) 쌍으로 복사한 뒤 정렬
+        double copySortMs = measureMs([&] {
+            vector<std::pair<double, string>> pairs;
+            pairs.reserve(count);
+            for (size_t i = 0; i < count; i++) pairs.emplace_back(studentScores[i], studentNames[i]);
+            std::sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) {
+                return a.first != b.first ? a.first > b.first : a.second < b.second;
+            });
+        });
+
+        cout << "쌍으로 복사 + std::sort: " << copySortMs << " ms" << endl;
+        cout << "행 번호 std::sort:       " << indexSortMs << " ms" << endl;
+
+        for (unsigned threads : {1u, 2u, 4u, 8u}) {
+            vector<uint32_t> result;
+            double ms = measureMs([&] { result = large.fullRanking(threads); });
+            cout << "기수 정렬 + 병합 (" << threads << "스레드): " << ms << " ms"
+                 << (result == expected ? " (std::sort와 일치)" : " (불일치!)") << endl;
+        }
+        cout << "하드웨어 스레드: " << std::thread::hardware_concurrency() << "개" << endl;
+
+        cout << "\n=== 상위 K (ms) ===" << endl;
+        for (size_t k : {10, 100, 10000}) {
+            vector<uint32_t> top;
+            double heapMs = measureMs([&] { top = large.topK(k); });
+            vector<uint32_t> partial(count);
+            for (uint32_t i = 0; i < count; i++) partial[i] = i;
+            double partialMs = measureMs([&] {
+                std::partial_sort(partial.begin(), partial.begin() + k, partial.end(),
+                                  [&](uint32_t a, uint32_t b) { return large.ranksBefore(a, b); });
+            });
+            bool same = std::equal(top.begin(), top.end(), expected.begin());
+            cout << "K = " << k << " - 힙: " << heapMs << ", partial_sort: " << partialMs
+                 << (same ? " (전체 순위의 앞부분과 일치)" : " (불일치!)") << endl;
+        }
+
+        uint32_t first = expected.front();
+        cout << "1등: " << studentNames[first] << " (" << studentScores[first] << "점)" << endl;
+    }
+    catch (const std::exception& e) {
+        cout << "예외 발생: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
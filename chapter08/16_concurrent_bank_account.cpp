@@ -0,0 +1,276 @@
+/*
+ * 동시 접근 가능한 은행 계좌
+ * 파일명: 16_concurrent_bank_account.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 16_concurrent_bank_account 16_concurrent_bank_account.cpp
+ * 실행: ./16_concurrent_bank_account (Linux/Mac) 또는 16_concurrent_bank_account.exe (Windows)
+ */
+
+/*
+주제: 락 없는(lock-free) 계좌 잔액
+정의: 02_custom_exception.cpp의 BankAccount는 double balance를 동기화 없이 고치므로
+      여러 스레드가 동시에 deposit/withdraw를 부르면 데이터 경쟁이 생긴다.
+      뮤텍스로 감싸면 안전하지만 모든 거래가 한 줄로 서게 된다.
+      ConcurrentBankAccount는 잔액을 정수 최소 단위(1/100원)로 atomic에 저장하고 CAS 루프로 갱신한다.
+
+핵심 개념: 고정 소수점 금액, CAS 루프, 실패도 원자적으로
+정의:
+- 고정 소수점: 0.1 + 0.2 != 0.3 인 double 대신 정수 최소 단위로 저장하여 합계가 정확하다
+- CAS(compare-and-swap) 루프: 현재 값을 읽고, 새 값을 계산하고, 그 사이 아무도 바꾸지 않았을 때만 쓴다
+- 잔액 부족 판단과 차감이 같은 CAS 안에서 일어나므로, 확인 후 다른 스레드가 먼저 빼가는 일이 없다
+- 자주 일어나는 실패(잔액 부족)는 예외 대신 상태 코드로 돌려주고, 기존 예외 API는 그 위의 얇은 포장이다
+*/
+
+#include <iostream>
+#include <exception>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+using namespace std;
+
+// 02_custom_exception.cpp와 같은 예외 계층
+class BankException : public exception {
+private:
+    string message;
+
+public:
+    BankException(const string& msg) : message(msg) {}
+
+    const char* what() const noexcept override {
+        return message.c_str();
+    }
+};
+
+class InsufficientFundsException : public BankException {
+public:
+    InsufficientFundsException(double requested, double available)
+        : BankException("잔액 부족: 요청금액 " + to_string(requested) +
+                       "원, 잔액 " + to_string(available) + "원") {}
+};
+
+class InvalidAmountException : public BankException {
+public:
+    InvalidAmountException() : BankException("유효하지 않은 금액입니다.") {}
+};
+
+// 금액: 1/100원 단위 정수
+using MinorUnits = int64_t;
+constexpr MinorUnits MINOR_PER_WON = 100;
+
+// double 금액을 최소 단위로 변환 (음수, NaN, 범위 초과는 -1)
+MinorUnits toMinorUnits(double amount) {
+    double scaled = amount * MINOR_PER_WON;
+    if (!(scaled >= 0) || scaled >= 9.0e18) return -1;
+    return llround(scaled);
+}
+
+double toWon(MinorUnits minor) {
+    return static_cast<double>(minor) / MINOR_PER_WON;
+}
+
+enum class TransactionStatus {
+    Ok,
+    InvalidAmount,
+    InsufficientFunds,
+    Overflow
+};
+
+const char* statusToString(TransactionStatus status) {
+    switch (status) {
+        case TransactionStatus::Ok: return "성공";
+        case TransactionStatus::InvalidAmount: return "유효하지 않은 금액";
+        case TransactionStatus::InsufficientFunds: return "잔액 부족";
+        case TransactionStatus::Overflow: return "잔액 한도 초과";
+    }
+    return "알 수 없음";
+}
+
+class ConcurrentBankAccount {
+private:
+    // 다른 계좌와 같은 캐시 라인을 쓰지 않도록 정렬
+    alignas(64) atomic<MinorUnits> balance;
+
+public:
+    explicit ConcurrentBankAccount(MinorUnits initial) : balance(initial) {}
+
+    // 예외 없는 API (최소 단위)
+    TransactionStatus deposit(MinorUnits amount) noexcept {
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        MinorUnits current = balance.load(memory_order_relaxed);
+        do {
+            if (current > numeric_limits<MinorUnits>::max() - amount) {
+                return TransactionStatus::Overflow;
+            }
+        } while (!balance.compare_exchange_weak(current, current + amount,
+                                                memory_order_acq_rel, memory_order_relaxed));
+        return TransactionStatus::Ok;
+    }
+
+    TransactionStatus withdraw(MinorUnits amount) noexcept {
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        MinorUnits current = balance.load(memory_order_relaxed);
+        do {
+            // 실패해도 잔액은 그대로 (부분 차감 없음)
+            if (current < amount) return TransactionStatus::InsufficientFunds;
+        } while (!balance.compare_exchange_weak(current, current - amount,
+                                                memory_order_acq_rel, memory_order_relaxed));
+        return TransactionStatus::Ok;
+    }
+
+    MinorUnits getBalanceMinor() const noexcept {
+        return balance.load(memory_order_acquire);
+    }
+
+    // 기존 BankAccount와 같은 원 단위 예외 API
+    void depositWon(double amount) {
+        MinorUnits minor = toMinorUnits(amount);
+        if (minor <= 0 || deposit(minor) != TransactionStatus::Ok) {
+            throw InvalidAmountException();
+        }
+    }
+
+    void withdrawWon(double amount) {
+        MinorUnits minor = toMinorUnits(amount);
+        if (minor <= 0) {
+            throw InvalidAmountException();
+        }
+        if (withdraw(minor) == TransactionStatus::InsufficientFunds) {
+            throw InsufficientFundsException(amount, getBalance());
+        }
+    }
+
+    double getBalance() const noexcept { return toWon(getBalanceMinor()); }
+};
+
+// 비교용: 같은 규칙을 뮤텍스로 보호
+class MutexBankAccount {
+private:
+    mutable mutex lock;
+    MinorUnits balance;
+
+public:
+    explicit MutexBankAccount(MinorUnits initial) : balance(initial) {}
+
+    TransactionStatus deposit(MinorUnits amount) {
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        lock_guard<mutex> guard(lock);
+        if (balance > numeric_limits<MinorUnits>::max() - amount) return TransactionStatus::Overflow;
+        balance += amount;
+        return TransactionStatus::Ok;
+    }
+
+    TransactionStatus withdraw(MinorUnits amount) {
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        lock_guard<mutex> guard(lock);
+        if (balance < amount) return TransactionStatus::InsufficientFunds;
+        balance -= amount;
+        return TransactionStatus::Ok;
+    }
+
+    MinorUnits getBalanceMinor() const {
+        lock_guard<mutex> guard(lock);
+        return balance;
+    }
+};
+
+struct ContentionResult {
+    double millis;
+    long long successfulDeposits;
+    long long successfulWithdrawals;
+    MinorUnits finalBalance;
+};
+
+// threadCount개 스레드가 한 계좌에 입금/출금을 번갈아 요청
+template<typename Account>
+ContentionResult runContention(int threadCount, long long totalOperations) {
+    const MinorUnits INITIAL = 1000 * MINOR_PER_WON;
+    const MinorUnits DEPOSIT = 70 * MINOR_PER_WON;
+    const MinorUnits WITHDRAW = 100 * MINOR_PER_WON;  // 출금이 더 커서 잔액 부족이 자주 발생
+
+    Account account(INITIAL);
+    atomic<long long> deposits{0}, withdrawals{0};
+    long long perThread = totalOperations / threadCount;
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t] {
+            long long myDeposits = 0, myWithdrawals = 0;
+            for (long long i = 0; i < perThread; i++) {
+                if ((i + t) % 2 == 0) {
+                    if (account.deposit(DEPOSIT) == TransactionStatus::Ok) myDeposits++;
+                } else {
+                    if (account.withdraw(WITHDRAW) == TransactionStatus::Ok) myWithdrawals++;
+                }
+            }
+            deposits += myDeposits;
+            withdrawals += myWithdrawals;
+        });
+    }
+    for (auto& w : workers) w.join();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    MinorUnits finalBalance = account.getBalanceMinor();
+    MinorUnits expected = INITIAL + deposits * DEPOSIT - withdrawals * WITHDRAW;
+    if (finalBalance != expected || finalBalance < 0) {
+        cout << "잔액 불일치! 기대 " << expected << ", 실제 " << finalBalance << endl;
+    }
+    return {ms, deposits.load(), withdrawals.load(), finalBalance};
+}
+
+int main() {
+    cout << "=== 고정 소수점 금액 ===" << endl;
+    double sum = 0;
+    MinorUnits minorSum = 0;
+    for (int i = 0; i < 10; i++) {
+        sum += 0.1;
+        minorSum += toMinorUnits(0.1);
+    }
+    cout.precision(17);
+    cout << "double로 0.1원 10번: " << sum << "원" << endl;
+    cout << "최소 단위로 0.1원 10번: " << toWon(minorSum) << "원" << endl;
+    cout.precision(6);
+
+    cout << "\n=== 예외 없는 API ===" << endl;
+    ConcurrentBankAccount account(100000 * MINOR_PER_WON);
+    cout << "50000원 입금: " << statusToString(account.deposit(50000 * MINOR_PER_WON)) << endl;
+    cout << "300000원 출금: " << statusToString(account.withdraw(300000 * MINOR_PER_WON)) << endl;
+    cout << "-1 출금: " << statusToString(account.withdraw(-1)) << endl;
+    cout << "잔액: " << account.getBalance() << "원 (실패한 거래는 잔액을 바꾸지 않음)" << endl;
+
+    cout << "\n=== 기존 예외 API ===" << endl;
+    try {
+        account.withdrawWon(30000);
+        cout << "30000원 출금 완료. 잔액: " << account.getBalance() << "원" << endl;
+        account.withdrawWon(200000);  // 잔액 부족
+    }
+    catch (const InsufficientFundsException& e) {
+        cout << "잔액 오류: " << e.what() << endl;
+    }
+    try {
+        account.depositWon(-1000);
+    }
+    catch (const BankException& e) {
+        cout << "은행 오류: " << e.what() << endl;
+    }
+
+    cout << "\n=== 경합 벤치마크 (한 계좌, 총 200만 건, 출금의 일부는 잔액 부족) ===" << endl;
+    const long long TOTAL = 2000000;
+    cout << "스레드 | CAS (ms) | 뮤텍스 (ms) | 성공 출금 (CAS / 뮤텍스)" << endl;
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        ContentionResult lockFree = runContention<ConcurrentBankAccount>(threads, TOTAL);
+        ContentionResult locked = runContention<MutexBankAccount>(threads, TOTAL);
+        cout << threads << " | " << lockFree.millis << " | " << locked.millis
+             << " | " << lockFree.successfulWithdrawals << " / " << locked.successfulWithdrawals << endl;
+    }
+    cout << "하드웨어 스레드: " << thread::hardware_concurrency() << "개" << endl;
+    cout << "(모든 실행에서 최종 잔액 = 초기 잔액 + 입금 - 성공한 출금 을 확인함)" << endl;
+
+    return 0;
+}
@@ -0,0 +1,374 @@
+/*
+ * 샤딩된 계좌 원장
+ * 파일명: 17_sharded_ledger.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 17_sharded_ledger 17_sharded_ledger.cpp
+ * 실행: ./17_sharded_ledger (Linux/Mac) 또는 17_sharded_ledger.exe (Windows)
+ */
+
+/*
+주제: 샤딩된 원장 (Sharded Ledger)
+정의: BankAccount에는 계좌 간 이체 개념이 없고, 모든 계좌를 하나의 뮤텍스로 묶으면
+      초당 수백만 건의 이체가 한 줄로 처리된다.
+      ShardedLedger는 계좌를 여러 샤드에 나누고, 샤드마다 하나의 작업 스레드만 잔액을 고친다.
+
+핵심 개념: 단일 작성자, 2단계 이체, 일괄 제출, 잔액 보존
+정의:
+- 단일 작성자: 샤드의 잔액은 그 샤드의 작업 스레드만 읽고 쓰므로 잔액 자체에는 락이 없다
+- 2단계 이체: 다른 샤드로의 이체는 (1) 보내는 샤드에서 출금 (2) 받는 샤드에 입금 명령 전달 순서로 처리한다.
+  출금이 실패하면 입금 명령은 만들어지지 않고, 이동 중인 금액은 inFlight로 따로 센다
+- 일괄 제출: submitBatch는 수천 건을 샤드별로 나눈 뒤 샤드마다 한 번만 락을 잡고 넣는다
+- 잔액 보존: 어떤 순서로 처리되든 (모든 잔액의 합 + 이동 중 금액)은 처음 총액과 같다
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+// 금액: 1/100원 단위 정수 (16_concurrent_bank_account.cpp와 같음)
+using MinorUnits = int64_t;
+constexpr MinorUnits MINOR_PER_WON = 100;
+
+using AccountId = uint32_t;
+
+struct Transfer {
+    AccountId from;
+    AccountId to;
+    MinorUnits amount;
+};
+
+struct LedgerStats {
+    long long applied = 0;       // 입금까지 끝난 이체
+    long long rejected = 0;      // 잔액 부족으로 거절
+    long long invalid = 0;       // 잘못된 계좌 번호나 금액 (제출 시 거절)
+    long long crossShard = 0;    // 샤드를 넘나든 이체
+};
+
+class ShardedLedger {
+private:
+    enum class CommandKind : uint8_t { Transfer, Credit };
+
+    struct Command {
+        CommandKind kind;
+        AccountId from;
+        AccountId to;
+        MinorUnits amount;
+    };
+
+    struct Shard {
+        vector<MinorUnits> balances;  // 작업 스레드만 접근
+
+        mutex queueLock;
+        condition_variable queueReady;
+        vector<Command> incoming;
+        bool stopping = false;
+
+        // 작업 스레드만 쓰는 통계
+        atomic<long long> applied{0}, rejected{0}, crossShard{0};
+        thread worker;
+    };
+
+    size_t accountCount;
+    vector<unique_ptr<Shard>> shards;
+
+    atomic<long long> outstanding{0};    // 아직 처리되지 않은 명령 수
+    atomic<MinorUnits> inFlight{0};      // 출금됐지만 아직 입금되지 않은 금액
+    atomic<long long> invalidCount{0};
+    shared_mutex submitGate;             // 제출은 공유, 잔액 조회는 배타 (조회 중 새 제출을 막음)
+    mutex idleLock;
+    condition_variable idle;
+
+    size_t shardOf(AccountId id) const { return id % shards.size(); }
+    size_t slotOf(AccountId id) const { return id / shards.size(); }
+
+    void enqueue(size_t shardIndex, const Command* commands, size_t count) {
+        if (count == 0) return;
+        Shard& shard = *shards[shardIndex];
+        outstanding.fetch_add(static_cast<long long>(count), memory_order_relaxed);
+        {
+            lock_guard<mutex> guard(shard.queueLock);
+            shard.incoming.insert(shard.incoming.end(), commands, commands + count);
+        }
+        shard.queueReady.notify_one();
+    }
+
+    void apply(Shard& shard, const Command& command) {
+        if (command.kind == CommandKind::Credit) {
+            shard.balances[slotOf(command.to)] += command.amount;
+            inFlight.fetch_sub(command.amount, memory_order_relaxed);
+            shard.applied.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+
+        MinorUnits& source = shard.balances[slotOf(command.from)];
+        if (source < command.amount) {
+            shard.rejected.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        source -= command.amount;
+
+        size_t target = shardOf(command.to);
+        if (&shard == shards[target].get()) {
+            shard.balances[slotOf(command.to)] += command.amount;
+            shard.applied.fetch_add(1, memory_order_relaxed);
+        } else {
+            // 2단계: 출금은 끝났고, 입금은 받는 샤드의 작업 스레드가 처리
+            inFlight.fetch_add(command.amount, memory_order_relaxed);
+            shard.crossShard.fetch_add(1, memory_order_relaxed);
+            Command credit{CommandKind::Credit, command.from, command.to, command.amount};
+            enqueue(target, &credit, 1);
+        }
+    }
+
+    void workerLoop(Shard& shard) {
+        vector<Command> working;
+        while (true) {
+            {
+                unique_lock<mutex> guard(shard.queueLock);
+                shard.queueReady.wait(guard, [&] { return shard.stopping || !shard.incoming.empty(); });
+                if (shard.incoming.empty()) return;  // stopping이고 더 할 일이 없음
+                working.swap(shard.incoming);        // 통째로 가져와 락을 짧게 유지
+            }
+            for (const Command& command : working) {
+                apply(shard, command);
+            }
+            long long left = outstanding.fetch_sub(static_cast<long long>(working.size()),
+                                                   memory_order_acq_rel) - static_cast<long long>(working.size());
+            working.clear();
+            if (left == 0) {
+                lock_guard<mutex> guard(idleLock);
+                idle.notify_all();
+            }
+        }
+    }
+
+public:
+    ShardedLedger(size_t accounts, MinorUnits initialBalance, size_t shardCount)
+        : accountCount(accounts) {
+        if (accounts == 0 || accounts > UINT32_MAX || shardCount == 0) {
+            throw invalid_argument("계좌 수와 샤드 수는 1 이상이어야 합니다");
+        }
+        if (initialBalance < 0) {
+            throw invalid_argument("초기 잔액은 음수일 수 없습니다");
+        }
+        for (size_t s = 0; s < shardCount; s++) {
+            auto shard = make_unique<Shard>();
+            shard->balances.assign((accounts - s + shardCount - 1) / shardCount, initialBalance);
+            shards.push_back(move(shard));
+        }
+        for (auto& shard : shards) {
+            Shard* raw = shard.get();
+            raw->worker = thread([this, raw] { workerLoop(*raw); });
+        }
+    }
+
+    ~ShardedLedger() {
+        flush();  // 샤드 간 입금 명령이 남아 있을 수 있으므로 먼저 모두 처리
+        for (auto& shard : shards) {
+            {
+                lock_guard<mutex> guard(shard->queueLock);
+                shard->stopping = true;
+            }
+            shard->queueReady.notify_one();
+        }
+        for (auto& shard : shards) shard->worker.join();
+    }
+
+    ShardedLedger(const ShardedLedger&) = delete;
+    ShardedLedger& operator=(const ShardedLedger&) = delete;
+
+    // 이체를 보내는 샤드별로 나누어 샤드마다 한 번씩만 넣는다. 큐에 넣은 건수를 반환
+    size_t submitBatch(const Transfer* transfers, size_t count) {
+        vector<vector<Command>> perShard(shards.size());
+        size_t queued = 0;
+        for (size_t i = 0; i < count; i++) {
+            const Transfer& t = transfers[i];
+            if (t.from >= accountCount || t.to >= accountCount || t.amount <= 0) {
+                invalidCount.fetch_add(1, memory_order_relaxed);
+                continue;
+            }
+            perShard[shardOf(t.from)].push_back(Command{CommandKind::Transfer, t.from, t.to, t.amount});
+            queued++;
+        }
+        shared_lock<shared_mutex> gate(submitGate);
+        for (size_t s = 0; s < shards.size(); s++) {
+            enqueue(s, perShard[s].data(), perShard[s].size());
+        }
+        return queued;
+    }
+
+    size_t submitBatch(const vector<Transfer>& transfers) {
+        return submitBatch(transfers.data(), transfers.size());
+    }
+
+    bool submit(const Transfer& transfer) {
+        return submitBatch(&transfer, 1) == 1;
+    }
+
+    // 지금까지 제출된 모든 이체(와 그로 인한 입금)가 끝날 때까지 대기
+    void flush() {
+        unique_lock<mutex> guard(idleLock);
+        idle.wait(guard, [&] { return outstanding.load(memory_order_acquire) == 0; });
+    }
+
+    // 잔액은 작업 스레드의 소유이므로, 새 제출을 막고 큐가 빌 때까지 기다린 뒤 읽는다
+    MinorUnits balanceOf(AccountId id) {
+        if (id >= accountCount) throw out_of_range("존재하지 않는 계좌입니다");
+        unique_lock<shared_mutex> gate(submitGate);
+        flush();
+        return shards[shardOf(id)]->balances[slotOf(id)];
+    }
+
+    MinorUnits totalBalance() {
+        unique_lock<shared_mutex> gate(submitGate);
+        flush();
+        MinorUnits total = inFlight.load(memory_order_acquire);
+        for (auto& shard : shards) {
+            for (MinorUnits balance : shard->balances) total += balance;
+        }
+        return total;
+    }
+
+    LedgerStats stats() const {
+        LedgerStats result;
+        for (auto& shard : shards) {
+            result.applied += shard->applied.load(memory_order_relaxed);
+            result.rejected += shard->rejected.load(memory_order_relaxed);
+            result.crossShard += shard->crossShard.load(memory_order_relaxed);
+        }
+        result.invalid = invalidCount.load(memory_order_relaxed);
+        return result;
+    }
+
+    size_t shardCount() const { return shards.size(); }
+};
+
+// 비교용: 모든 계좌를 하나의 뮤텍스로 보호
+class GlobalMutexLedger {
+private:
+    mutex lock;
+    vector<MinorUnits> balances;
+
+public:
+    GlobalMutexLedger(size_t accounts, MinorUnits initialBalance) : balances(accounts, initialBalance) {}
+
+    void submitBatch(const vector<Transfer>& transfers) {
+        for (const Transfer& t : transfers) {
+            lock_guard<mutex> guard(lock);  // 기존 방식처럼 거래마다 락
+            if (balances[t.from] < t.amount) continue;
+            balances[t.from] -= t.amount;
+            balances[t.to] += t.amount;
+        }
+    }
+
+    MinorUnits totalBalance() {
+        lock_guard<mutex> guard(lock);
+        MinorUnits total = 0;
+        for (MinorUnits balance : balances) total += balance;
+        return total;
+    }
+};
+
+vector<vector<Transfer>> makeBatches(size_t accounts, size_t batchCount, size_t batchSize, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<AccountId> account(0, static_cast<AccountId>(accounts - 1));
+    uniform_int_distribution<MinorUnits> amount(1, 500 * MINOR_PER_WON);
+    vector<vector<Transfer>> batches(batchCount);
+    for (auto& batch : batches) {
+        batch.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; i++) {
+            batch.push_back(Transfer{account(rng), account(rng), amount(rng)});
+        }
+    }
+    return batches;
+}
+
+template<typename Ledger>
+double runProducers(Ledger& ledger, const vector<vector<vector<Transfer>>>& work) {
+    auto start = chrono::steady_clock::now();
+    vector<thread> producers;
+    for (const auto& batches : work) {
+        producers.emplace_back([&ledger, &batches] {
+            for (const auto& batch : batches) ledger.submitBatch(batch);
+        });
+    }
+    for (auto& p : producers) p.join();
+    ledger.totalBalance();  // 샤딩된 원장은 여기서 남은 명령을 모두 처리
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    try {
+        cout << "=== 기본 이체 ===" << endl;
+        {
+            ShardedLedger ledger(4, 1000 * MINOR_PER_WON, 2);
+            ledger.submit({0, 1, 300 * MINOR_PER_WON});   // 다른 샤드 (0 -> 1)
+            ledger.submit({2, 0, 500 * MINOR_PER_WON});   // 같은 샤드 (2 -> 0)
+            ledger.submit({3, 2, 5000 * MINOR_PER_WON});  // 잔액 부족
+            ledger.submit({0, 9, 100});                   // 없는 계좌
+            for (AccountId id = 0; id < 4; id++) {
+                cout << "계좌 " << id << ": " << ledger.balanceOf(id) / MINOR_PER_WON << "원" << endl;
+            }
+            LedgerStats s = ledger.stats();
+            cout << "처리 " << s.applied << ", 거절 " << s.rejected << ", 잘못된 요청 " << s.invalid
+                 << ", 샤드 간 " << s.crossShard << endl;
+        }
+
+        cout << "\n=== 스트레스 테스트 (잔액 보존) ===" << endl;
+        const size_t ACCOUNTS = 100000;
+        const MinorUnits INITIAL = 1000 * MINOR_PER_WON;
+        const MinorUnits EXPECTED_TOTAL = INITIAL * static_cast<MinorUnits>(ACCOUNTS);
+        const int PRODUCERS = 4;
+        const size_t BATCHES = 100, BATCH_SIZE = 4096;
+
+        vector<vector<vector<Transfer>>> work;
+        for (int p = 0; p < PRODUCERS; p++) {
+            work.push_back(makeBatches(ACCOUNTS, BATCHES, BATCH_SIZE, 100 + p));
+        }
+        double totalTransfers = double(PRODUCERS) * BATCHES * BATCH_SIZE;
+
+        // 샤드마다 작업 스레드가 하나이므로 코어 수보다 많은 샤드는 이득이 없다
+        for (size_t shardCount : {1, 2, 4, 8}) {
+            ShardedLedger ledger(ACCOUNTS, INITIAL, shardCount);
+            double ms = runProducers(ledger, work);
+
+            // 중간 점검: 다른 스레드가 제출하는 도중에 조회해도 총액이 같아야 한다
+            vector<vector<vector<Transfer>>> more{makeBatches(ACCOUNTS, 4, BATCH_SIZE, 7)};
+            thread extra([&] { runProducers(ledger, more); });
+            MinorUnits midTotal = ledger.totalBalance();
+            extra.join();
+            MinorUnits finalTotal = ledger.totalBalance();
+
+            LedgerStats s = ledger.stats();
+            cout << shardCount << "개 샤드: " << ms << " ms ("
+                 << static_cast<long long>(totalTransfers / ms * 1000) << "건/초), 처리 " << s.applied
+                 << ", 거절 " << s.rejected << ", 샤드 간 " << s.crossShard << endl;
+            cout << "  총액 확인: " << (midTotal == EXPECTED_TOTAL && finalTotal == EXPECTED_TOTAL ? "보존됨" : "불일치!")
+                 << " (" << finalTotal / MINOR_PER_WON << "원)" << endl;
+        }
+
+        GlobalMutexLedger global(ACCOUNTS, INITIAL);
+        double globalMs = runProducers(global, work);
+        cout << "전역 뮤텍스: " << globalMs << " ms ("
+             << static_cast<long long>(totalTransfers / globalMs * 1000) << "건/초), 총액 "
+             << (global.totalBalance() == EXPECTED_TOTAL ? "보존됨" : "불일치!") << endl;
+        cout << "하드웨어 스레드: " << thread::hardware_concurrency() << "개" << endl;
+    }
+    catch (const exception& e) {
+        cout << "예외 발생: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
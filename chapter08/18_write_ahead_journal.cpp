@@ -0,0 +1,723 @@
+/*
+ * 그룹 커밋 선행 기록 저널
+ * 파일명: 18_write_ahead_journal.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -pthread -o 18_write_ahead_journal 18_write_ahead_journal.cpp
+ * 실행: ./18_write_ahead_journal (Linux/Mac)
+ */
+
+/*
+주제: 선행 기록 저널 (Write-Ahead Journal)
+정의: BankAccount의 deposit/withdraw는 메모리만 바꾸므로 프로그램이 죽으면 모든 거래가 사라진다.
+      거래마다 fsync를 하면 안전하지만, fsync 한 번이 수 밀리초라서 처리량이 fsync 속도로 묶인다.
+      JournaledBank는 거래를 먼저 추가 전용 저널에 기록하고, 동시에 들어온 커밋들을
+      한 번의 fsync로 묶어(그룹 커밋) 디스크에 내린다.
+
+핵심 개념: 선행 기록, 그룹 커밋, 재생 복구, 스냅샷
+정의:
+- 선행 기록: 거래는 저널 레코드(LSN, 계좌, 금액, 체크섬)로 기록되고, fsync가 끝난 뒤에야 성공으로 보고된다
+- 그룹 커밋: 먼저 온 스레드가 리더가 되어 그때까지 쌓인 레코드를 한 번에 쓰고 fsync한다.
+  리더가 fsync하는 동안 도착한 커밋은 다음 묶음이 되므로, 동시 커밋이 많을수록 묶음이 커진다
+- 재생 복구: 시작할 때 스냅샷을 읽고, 그 이후 LSN의 저널 레코드를 순서대로 다시 적용한다.
+  마지막 세그먼트 끝에 반쯤 쓰인 레코드는 잘라내고, 그 밖의 체크섬/LSN 불일치는 손상으로 보고한다
+- 스냅샷: 일정 건수마다 잔액 전체를 원자적으로 저장하고 그 이전 저널 세그먼트를 지워 복구 시간을 제한한다
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+using namespace std;
+namespace fs = std::filesystem;
+
+// 금액: 1/100원 단위 정수 (16_concurrent_bank_account.cpp와 같음)
+using MinorUnits = int64_t;
+constexpr MinorUnits MINOR_PER_WON = 100;
+
+enum class TransactionStatus {
+    Ok,
+    InvalidAmount,
+    InsufficientFunds
+};
+
+inline uint64_t checksum(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ p[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// 저널 레코드: 고정 32바이트. amount는 잔액 변화량(출금은 음수)
+struct JournalRecord {
+    uint64_t lsn;
+    uint32_t accountId;
+    uint32_t reserved;
+    int64_t amount;
+    uint64_t check;
+};
+static_assert(sizeof(JournalRecord) == 32, "저널 레코드는 32바이트여야 합니다");
+
+inline uint64_t recordChecksum(const JournalRecord& record) {
+    return checksum(&record, offsetof(JournalRecord, check));
+}
+
+// 파일 디스크립터 RAII 래퍼
+class FileDescriptor {
+private:
+    int fd;
+
+public:
+    explicit FileDescriptor(int f = -1) : fd(f) {}
+    ~FileDescriptor() {
+        if (fd >= 0) close(fd);
+    }
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const { return fd; }
+    void reset(int f) {
+        if (fd >= 0) close(fd);
+        fd = f;
+    }
+};
+
+void writeAll(int fd, const void* data, size_t size, const string& filename) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error("파일 쓰기 중 오류가 발생했습니다: " + filename);
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+}
+
+void syncDirectory(const string& directory) {
+    FileDescriptor dir(open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dir.get() < 0 || fsync(dir.get()) != 0) {
+        throw runtime_error("디렉터리 동기화 실패: " + directory);
+    }
+}
+
+// mkstemp는 0600으로 만들므로, 교체 전에 기존 파일의 권한(없으면 0666 & ~umask)을 입힌다
+void copyPermissions(int fd, const string& target, const string& tempName) {
+    struct stat st;
+    mode_t mode;
+    if (stat(target.c_str(), &st) == 0) {
+        mode = st.st_mode & 07777;
+    } else {
+        mode_t mask = umask(0);  // umask는 읽기 전용 함수가 없어 설정 후 되돌린다
+        umask(mask);
+        mode = 0666 & ~mask;
+    }
+    if (fchmod(fd, mode) != 0) {
+        throw runtime_error("임시 파일 권한 설정 실패: " + tempName);
+    }
+}
+
+struct JournalMetrics {
+    uint64_t commits = 0;
+    uint64_t fsyncs = 0;
+    double averageBatch = 0;     // fsync 한 번에 내려간 레코드 수
+    uint64_t maxBatch = 0;
+    double fsyncsPerSecond = 0;
+    double p50LatencyUs = 0;     // 커밋 요청부터 fsync 완료까지 (2의 거듭제곱 구간 상한)
+    double p99LatencyUs = 0;
+};
+
+class GroupCommitJournal {
+private:
+    string directory;
+    bool groupCommit;
+
+    mutex lock;
+    condition_variable durableChanged;
+    FileDescriptor fd;
+    string segmentPath;
+    vector<string> segments;          // 현재 세그먼트를 포함한 모든 세그먼트 (오래된 순)
+    vector<JournalRecord> pending;    // 아직 쓰지 않은 레코드
+    vector<JournalRecord> writing;    // 리더가 쓰는 중인 묶음
+    uint64_t lastAppended = 0;
+    uint64_t durable = 0;
+    bool leaderActive = false;
+    string failure;                   // 쓰기/fsync 실패 후에는 모든 커밋이 실패한다 (두 모드 모두)
+
+    // 지표
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+    atomic<uint64_t> commitCount{0}, fsyncCount{0}, syncedRecords{0}, maxBatch{0};
+    array<atomic<uint64_t>, 40> latencyBuckets{};  // 구간 i: [2^i, 2^(i+1)) 마이크로초
+
+    static string segmentName(uint64_t firstLsn) {
+        char name[48];
+        snprintf(name, sizeof(name), "journal-%020llu.log", static_cast<unsigned long long>(firstLsn));
+        return name;
+    }
+
+    void openSegment(uint64_t firstLsn) {
+        segmentPath = directory + "/" + segmentName(firstLsn);
+        int f = open(segmentPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+        if (f < 0) {
+            throw runtime_error("저널 세그먼트를 열 수 없습니다: " + segmentPath);
+        }
+        fd.reset(f);
+        syncDirectory(directory);  // 새 세그먼트 파일 자체가 사라지지 않도록
+        if (segments.empty() || segments.back() != segmentPath) {  // 복구 때 찾은 빈 세그먼트를 다시 여는 경우
+            segments.push_back(segmentPath);
+        }
+    }
+
+    // 묶음 하나를 쓰고 fsync (호출자는 lock을 잡고 있지 않다)
+    void writeBatch(const vector<JournalRecord>& batch) {
+        writeAll(fd.get(), batch.data(), batch.size() * sizeof(JournalRecord), segmentPath);
+        if (fdatasync(fd.get()) != 0) {
+            throw runtime_error("저널 동기화 실패: " + segmentPath);
+        }
+        fsyncCount.fetch_add(1, memory_order_relaxed);
+        syncedRecords.fetch_add(batch.size(), memory_order_relaxed);
+        uint64_t seen = maxBatch.load(memory_order_relaxed);
+        while (batch.size() > seen && !maxBatch.compare_exchange_weak(seen, batch.size())) {}
+    }
+
+    void recordLatency(chrono::steady_clock::time_point started) {
+        auto us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - started).count();
+        size_t bucket = 0;
+        while (bucket + 1 < latencyBuckets.size() && (uint64_t(1) << (bucket + 1)) <= static_cast<uint64_t>(us)) bucket++;
+        latencyBuckets[bucket].fetch_add(1, memory_order_relaxed);
+        commitCount.fetch_add(1, memory_order_relaxed);
+    }
+
+    double latencyPercentile(double p) const {
+        uint64_t total = 0;
+        for (auto& b : latencyBuckets) total += b.load(memory_order_relaxed);
+        if (total == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(total - 1)) + 1, seen = 0;
+        for (size_t i = 0; i < latencyBuckets.size(); i++) {
+            seen += latencyBuckets[i].load(memory_order_relaxed);
+            if (seen >= rank) return static_cast<double>(uint64_t(1) << (i + 1));
+        }
+        return 0;
+    }
+
+public:
+    // existingSegments: 복구 때 발견한 세그먼트. 새 기록은 항상 새 세그먼트에 쓴다
+    GroupCommitJournal(const string& dir, uint64_t lastLsn, vector<string> existingSegments, bool useGroupCommit)
+        : directory(dir), groupCommit(useGroupCommit), segments(move(existingSegments)),
+          lastAppended(lastLsn), durable(lastLsn) {
+        openSegment(lastLsn + 1);
+    }
+
+    // 레코드에 LSN을 붙여 대기열에 넣는다. 호출자는 상태 락을 잡은 채로 부르므로
+    // LSN 순서 = 메모리에 적용된 순서다
+    uint64_t append(uint32_t accountId, MinorUnits delta) {
+        lock_guard<mutex> guard(lock);
+        if (!failure.empty()) throw runtime_error(failure);
+        JournalRecord record{++lastAppended, accountId, 0, delta, 0};
+        record.check = recordChecksum(record);
+        if (!groupCommit) {
+            // 비교용: 거래마다 즉시 쓰고 fsync (락을 잡은 채로).
+            // 실패하면 세그먼트 끝이 어떤 상태인지 알 수 없으므로 이후 커밋도 모두 거절한다
+            vector<JournalRecord> single{record};
+            try {
+                writeBatch(single);
+            }
+            catch (const exception& e) {
+                failure = e.what();
+                throw;
+            }
+            durable = record.lsn;
+            return record.lsn;
+        }
+        pending.push_back(record);
+        return record.lsn;
+    }
+
+    // lsn까지 디스크에 내려갈 때까지 대기. 리더가 없으면 직접 리더가 된다
+    void waitDurable(uint64_t lsn, chrono::steady_clock::time_point started) {
+        unique_lock<mutex> guard(lock);
+        while (durable < lsn) {
+            if (!failure.empty()) throw runtime_error(failure);
+            if (leaderActive) {
+                durableChanged.wait(guard);
+                continue;
+            }
+            leaderActive = true;
+            writing.swap(pending);
+            uint64_t batchLast = lastAppended;
+            guard.unlock();
+
+            string error;
+            try {
+                writeBatch(writing);
+            }
+            catch (const exception& e) {
+                error = e.what();
+            }
+
+            guard.lock();
+            writing.clear();
+            leaderActive = false;
+            if (error.empty()) {
+                durable = batchLast;
+            } else {
+                failure = error;
+            }
+            durableChanged.notify_all();
+        }
+        guard.unlock();
+        recordLatency(started);
+    }
+
+    // 지금까지의 레코드를 모두 내린 뒤 새 세그먼트로 바꾼다. 호출자는 상태 락을 잡고 있어야 한다.
+    // 반환값은 이제 닫힌(스냅샷이 저장되면 지워도 되는) 세그먼트들
+    vector<string> rotate() {
+        waitDurable(lastAppendedLsn(), chrono::steady_clock::now());
+        lock_guard<mutex> guard(lock);
+        vector<string> sealed = move(segments);
+        segments.clear();
+        openSegment(lastAppended + 1);
+        return sealed;
+    }
+
+    uint64_t lastAppendedLsn() {
+        lock_guard<mutex> guard(lock);
+        return lastAppended;
+    }
+
+    JournalMetrics metrics() const {
+        JournalMetrics m;
+        m.commits = commitCount.load(memory_order_relaxed);
+        m.fsyncs = fsyncCount.load(memory_order_relaxed);
+        m.averageBatch = m.fsyncs ? static_cast<double>(syncedRecords.load(memory_order_relaxed)) / m.fsyncs : 0;
+        m.maxBatch = maxBatch.load(memory_order_relaxed);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        m.fsyncsPerSecond = seconds > 0 ? m.fsyncs / seconds : 0;
+        m.p50LatencyUs = latencyPercentile(0.50);
+        m.p99LatencyUs = latencyPercentile(0.99);
+        return m;
+    }
+
+    static bool isSegmentName(const string& name) {
+        return name.size() == segmentName(0).size() && name.rfind("journal-", 0) == 0 &&
+               name.compare(name.size() - 4, 4, ".log") == 0;
+    }
+};
+
+struct RecoveryStats {
+    bool snapshotLoaded = false;
+    uint64_t snapshotLsn = 0;
+    size_t segments = 0;
+    size_t replayed = 0;
+    bool tornTail = false;
+    double millis = 0;
+};
+
+struct JournalOptions {
+    bool groupCommit = true;
+    uint64_t checkpointEvery = 0;  // 이 건수마다 백그라운드 스냅샷 (0이면 수동)
+};
+
+class JournaledBank {
+private:
+    static constexpr char SNAPSHOT_MAGIC[8] = {'W', 'A', 'L', 'S', 'N', 'A', 'P', '1'};
+
+    struct SnapshotHeader {
+        char magic[8];
+        uint64_t lsn;
+        uint64_t count;
+        uint64_t check;  // 항목들의 체크섬
+    };
+
+    struct SnapshotEntry {
+        uint32_t accountId;
+        uint32_t reserved;
+        MinorUnits balance;
+    };
+
+    string directory;
+    JournalOptions options;
+    mutex stateLock;
+    unordered_map<uint32_t, MinorUnits> balances;
+    RecoveryStats recovery;
+    unique_ptr<GroupCommitJournal> journal;
+
+    mutex checkpointLock;
+    atomic<uint64_t> appendedSinceCheckpoint{0};
+    condition_variable checkpointWanted;
+    mutex checkpointWaitLock;
+    bool stopping = false;
+    thread checkpointer;
+
+    string snapshotPath() const { return directory + "/snapshot.bin"; }
+
+    void loadSnapshot() {
+        FileDescriptor f(open(snapshotPath().c_str(), O_RDONLY | O_CLOEXEC));
+        if (f.get() < 0) return;  // 아직 스냅샷이 없음
+
+        SnapshotHeader header;
+        if (read(f.get(), &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header)) ||
+            memcmp(header.magic, SNAPSHOT_MAGIC, 8) != 0 || header.count > (uint64_t(1) << 32)) {
+            throw runtime_error("스냅샷 헤더가 손상되었습니다: " + snapshotPath());
+        }
+        vector<SnapshotEntry> entries(header.count);
+        size_t bytes = entries.size() * sizeof(SnapshotEntry);
+        if (read(f.get(), entries.data(), bytes) != static_cast<ssize_t>(bytes) ||
+            checksum(entries.data(), bytes) != header.check) {
+            throw runtime_error("스냅샷 내용이 손상되었습니다: " + snapshotPath());
+        }
+        for (const auto& e : entries) balances[e.accountId] = e.balance;
+        recovery.snapshotLoaded = true;
+        recovery.snapshotLsn = header.lsn;
+    }
+
+    // 스냅샷 이후의 레코드를 순서대로 적용. 마지막 세그먼트 끝의 반쯤 쓰인 레코드만 잘라내고,
+    // 온전한 크기의 레코드가 체크섬이나 LSN이 맞지 않으면 손상이므로 예외를 던진다
+    uint64_t replaySegments(vector<string>& segmentPaths) {
+        vector<string> names;
+        for (const auto& entry : fs::directory_iterator(directory)) {
+            string name = entry.path().filename().string();
+            if (GroupCommitJournal::isSegmentName(name)) names.push_back(name);
+        }
+        sort(names.begin(), names.end());  // 0으로 채운 LSN이므로 이름 순 = LSN 순
+
+        uint64_t lastLsn = recovery.snapshotLsn;
+        for (size_t i = 0; i < names.size(); i++) {
+            string path = directory + "/" + names[i];
+            segmentPaths.push_back(path);
+            FileDescriptor f(open(path.c_str(), O_RDWR | O_CLOEXEC));
+            if (f.get() < 0) throw runtime_error("저널 세그먼트를 열 수 없습니다: " + path);
+
+            vector<JournalRecord> records(4096);
+            off_t validBytes = 0;
+            bool stop = false;
+            while (!stop) {
+                ssize_t n = read(f.get(), records.data(), records.size() * sizeof(JournalRecord));
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    throw runtime_error("저널 읽기 실패: " + path);
+                }
+                if (n == 0) break;
+                size_t whole = static_cast<size_t>(n) / sizeof(JournalRecord);
+                for (size_t r = 0; r < whole && !stop; r++) {
+                    const JournalRecord& rec = records[r];
+                    if (rec.check != recordChecksum(rec) || (rec.lsn > recovery.snapshotLsn && rec.lsn != lastLsn + 1)) {
+                        stop = true;
+                        break;
+                    }
+                    if (rec.lsn > recovery.snapshotLsn) {
+                        balances[rec.accountId] += rec.amount;
+                        lastLsn = rec.lsn;
+                        recovery.replayed++;
+                    }
+                    validBytes += sizeof(JournalRecord);
+                }
+                if (static_cast<size_t>(n) % sizeof(JournalRecord) != 0) stop = true;  // 잘린 레코드
+            }
+            recovery.segments++;
+
+            struct stat st;
+            if (fstat(f.get(), &st) != 0) throw runtime_error("저널 정보를 읽을 수 없습니다: " + path);
+            if (st.st_size != validBytes) {
+                if (i + 1 != names.size()) {
+                    throw runtime_error("마지막이 아닌 저널 세그먼트가 손상되었습니다: " + path);
+                }
+                if (st.st_size - validBytes >= static_cast<off_t>(sizeof(JournalRecord))) {
+                    throw runtime_error("저널 세그먼트 중간이 손상되었습니다 (위치 " + to_string(validBytes) + "): " + path);
+                }
+                // 기록 도중 죽어서 남은 끝부분: fsync되지 않았으므로 성공으로 보고된 적이 없는 거래다
+                recovery.tornTail = true;
+                if (ftruncate(f.get(), validBytes) != 0 || fdatasync(f.get()) != 0) {
+                    throw runtime_error("저널 끝부분 정리 실패: " + path);
+                }
+            }
+        }
+        return lastLsn;
+    }
+
+    void writeSnapshot(const vector<SnapshotEntry>& entries, uint64_t lsn) {
+        SnapshotHeader header{};
+        memcpy(header.magic, SNAPSHOT_MAGIC, 8);
+        header.lsn = lsn;
+        header.count = entries.size();
+        header.check = checksum(entries.data(), entries.size() * sizeof(SnapshotEntry));
+
+        // 12_atomic_file_replace.cpp와 같은 순서: 임시 파일 → fsync → rename → 디렉터리 fsync
+        string tempName = snapshotPath() + ".tmp.XXXXXX";
+        FileDescriptor temp(mkstemp(&tempName[0]));
+        if (temp.get() < 0) throw runtime_error("임시 파일을 생성할 수 없습니다: " + tempName);
+        try {
+            writeAll(temp.get(), &header, sizeof(header), tempName);
+            writeAll(temp.get(), entries.data(), entries.size() * sizeof(SnapshotEntry), tempName);
+            copyPermissions(temp.get(), snapshotPath(), tempName);
+            if (fsync(temp.get()) != 0) throw runtime_error("스냅샷 동기화 실패: " + tempName);
+            if (rename(tempName.c_str(), snapshotPath().c_str()) != 0) {
+                throw runtime_error("스냅샷 교체 실패: " + snapshotPath());
+            }
+        }
+        catch (...) {
+            unlink(tempName.c_str());
+            throw;
+        }
+        syncDirectory(directory);
+    }
+
+    // 스냅샷 스레드가 조건을 확인한 뒤 잠들기 전 사이에 알림이 사라지지 않도록 대기 락을 잡고 깨운다.
+    // 스냅샷 도중에도 건수는 계속 늘 수 있으므로 == 가 아니라 >= 로 판단한다
+    void noteAppended() {
+        if (options.checkpointEvery != 0 &&
+            appendedSinceCheckpoint.fetch_add(1, memory_order_relaxed) + 1 >= options.checkpointEvery) {
+            lock_guard<mutex> guard(checkpointWaitLock);
+            checkpointWanted.notify_one();
+        }
+    }
+
+    void checkpointLoop() {
+        unique_lock<mutex> guard(checkpointWaitLock);
+        while (true) {
+            checkpointWanted.wait(guard, [&] {
+                return stopping || appendedSinceCheckpoint.load(memory_order_relaxed) >= options.checkpointEvery;
+            });
+            if (stopping) return;
+            guard.unlock();
+            try {
+                checkpoint();
+            }
+            catch (const exception& e) {
+                cout << "스냅샷 실패: " << e.what() << endl;  // 저널은 그대로 있으므로 복구는 가능
+            }
+            guard.lock();
+        }
+    }
+
+public:
+    JournaledBank(const string& dir, JournalOptions opts = {}) : directory(dir), options(opts) {
+        auto start = chrono::steady_clock::now();
+        fs::create_directories(directory);
+        loadSnapshot();
+        vector<string> segmentPaths;
+        uint64_t lastLsn = replaySegments(segmentPaths);
+        journal = make_unique<GroupCommitJournal>(directory, lastLsn, move(segmentPaths), options.groupCommit);
+        recovery.millis = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        if (options.checkpointEvery != 0) {
+            checkpointer = thread([this] { checkpointLoop(); });
+        }
+    }
+
+    ~JournaledBank() {
+        if (checkpointer.joinable()) {
+            {
+                lock_guard<mutex> guard(checkpointWaitLock);
+                stopping = true;
+            }
+            checkpointWanted.notify_one();
+            checkpointer.join();
+        }
+    }
+
+    TransactionStatus deposit(uint32_t accountId, MinorUnits amount) {
+        auto started = chrono::steady_clock::now();
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        uint64_t lsn;
+        {
+            lock_guard<mutex> guard(stateLock);
+            lsn = journal->append(accountId, amount);
+            balances[accountId] += amount;
+        }
+        noteAppended();
+        journal->waitDurable(lsn, started);
+        return TransactionStatus::Ok;
+    }
+
+    TransactionStatus withdraw(uint32_t accountId, MinorUnits amount) {
+        auto started = chrono::steady_clock::now();
+        if (amount <= 0) return TransactionStatus::InvalidAmount;
+        uint64_t lsn;
+        {
+            lock_guard<mutex> guard(stateLock);
+            MinorUnits& balance = balances[accountId];
+            if (balance < amount) return TransactionStatus::InsufficientFunds;  // 실패는 기록하지 않는다
+            lsn = journal->append(accountId, -amount);
+            balance -= amount;
+        }
+        noteAppended();
+        journal->waitDurable(lsn, started);
+        return TransactionStatus::Ok;
+    }
+
+    MinorUnits balanceOf(uint32_t accountId) {
+        lock_guard<mutex> guard(stateLock);
+        auto it = balances.find(accountId);
+        return it == balances.end() ? 0 : it->second;
+    }
+
+    // 잔액 전체를 스냅샷으로 저장하고 그 이전 세그먼트를 지운다.
+    // 상태 락은 복사와 세그먼트 교체 동안만 잡는다
+    void checkpoint() {
+        lock_guard<mutex> one(checkpointLock);
+        vector<SnapshotEntry> entries;
+        vector<string> sealed;
+        uint64_t lsn;
+        {
+            lock_guard<mutex> guard(stateLock);
+            sealed = journal->rotate();
+            lsn = journal->lastAppendedLsn();
+            entries.reserve(balances.size());
+            for (const auto& [id, balance] : balances) entries.push_back({id, 0, balance});
+            appendedSinceCheckpoint.store(0, memory_order_relaxed);
+        }
+        writeSnapshot(entries, lsn);
+        for (const string& path : sealed) unlink(path.c_str());
+        syncDirectory(directory);
+    }
+
+    const RecoveryStats& recoveryStats() const { return recovery; }
+    JournalMetrics metrics() const { return journal->metrics(); }
+};
+
+void printMetrics(const JournalMetrics& m) {
+    cout << "  커밋 " << m.commits << "건, fsync " << m.fsyncs << "회 (초당 " << static_cast<long long>(m.fsyncsPerSecond)
+         << "회), 묶음 평균 " << m.averageBatch << " / 최대 " << m.maxBatch
+         << ", 지연 p50 < " << m.p50LatencyUs << "us, p99 < " << m.p99LatencyUs << "us" << endl;
+}
+
+void printRecovery(const RecoveryStats& r) {
+    cout << "  복구: 스냅샷 " << (r.snapshotLoaded ? "LSN " + to_string(r.snapshotLsn) : string("없음"))
+         << ", 세그먼트 " << r.segments << "개, 재생 " << r.replayed << "건"
+         << (r.tornTail ? ", 잘린 끝부분 정리" : "") << ", " << r.millis << " ms" << endl;
+}
+
+// threadCount개 스레드가 각자 계좌에 입금/출금을 반복
+double runWorkload(JournaledBank& bank, int threadCount, int opsPerThread) {
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&bank, t, opsPerThread] {
+            for (int i = 0; i < opsPerThread; i++) {
+                uint32_t account = static_cast<uint32_t>((t * 7 + i) % 32);
+                if (i % 3 == 2) {
+                    bank.withdraw(account, 50 * MINOR_PER_WON);
+                } else {
+                    bank.deposit(account, 40 * MINOR_PER_WON);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const string dir = "wal_demo";
+
+    try {
+        fs::remove_all(dir);
+
+        cout << "=== 기록, 스냅샷, 비정상 종료 후 복구 ===" << endl;
+        unordered_map<uint32_t, MinorUnits> expected;
+        {
+            JournaledBank bank(dir);
+            printRecovery(bank.recoveryStats());
+            for (uint32_t i = 0; i < 300; i++) {
+                uint32_t account = i % 10;
+                if (bank.deposit(account, (i + 1) * MINOR_PER_WON) == TransactionStatus::Ok) expected[account] += (i + 1) * MINOR_PER_WON;
+                if (i == 150) bank.checkpoint();
+            }
+            if (bank.withdraw(3, 1000000 * MINOR_PER_WON) == TransactionStatus::InsufficientFunds) {
+                cout << "  잔액 부족 출금은 저널에 기록되지 않음" << endl;
+            }
+            if (bank.withdraw(3, 100 * MINOR_PER_WON) == TransactionStatus::Ok) expected[3] -= 100 * MINOR_PER_WON;
+            // 여기서 스냅샷 없이 객체가 사라짐 = 프로그램이 죽은 것과 같다
+        }
+
+        // 쓰는 도중 죽어서 레코드 절반만 남은 상황을 흉내 낸다
+        for (const auto& entry : fs::directory_iterator(dir)) {
+            if (GroupCommitJournal::isSegmentName(entry.path().filename().string())) {
+                FileDescriptor f(open(entry.path().c_str(), O_WRONLY | O_APPEND | O_CLOEXEC));
+                char garbage[13] = "torn-record!";
+                writeAll(f.get(), garbage, sizeof(garbage), entry.path().string());
+            }
+        }
+
+        {
+            JournaledBank recovered(dir);
+            printRecovery(recovered.recoveryStats());
+            bool same = true;
+            for (const auto& [account, balance] : expected) {
+                if (recovered.balanceOf(account) != balance) same = false;
+            }
+            cout << "  복구된 잔액: " << (same ? "모두 일치" : "불일치!") << " (계좌 3: "
+                 << recovered.balanceOf(3) / MINOR_PER_WON << "원)" << endl;
+            for (int i = 0; i < 4; i++) recovered.deposit(0, MINOR_PER_WON);  // 새 세그먼트에 기록
+        }
+
+        // 마지막 세그먼트라도 중간의 온전한 레코드가 손상되면 잘라내지 않고 오류로 알린다
+        {
+            string last;
+            for (const auto& entry : fs::directory_iterator(dir)) {
+                string name = entry.path().filename().string();
+                if (GroupCommitJournal::isSegmentName(name) && name > last) last = name;
+            }
+            FileDescriptor f(open((dir + "/" + last).c_str(), O_WRONLY | O_CLOEXEC));
+            if (pwrite(f.get(), "X", 1, sizeof(JournalRecord) + 8) != 1) throw runtime_error("테스트 데이터 쓰기 실패");
+        }
+        try {
+            JournaledBank corrupted(dir);
+            cout << "  손상이 발견되지 않음!" << endl;
+        }
+        catch (const exception& e) {
+            cout << "  예상된 오류: " << e.what() << endl;
+        }
+
+        cout << "\n=== 거래마다 fsync vs 그룹 커밋 ===" << endl;
+        for (int threads : {1, 8, 64}) {
+            int opsPerThread = 1600 / threads;
+            for (bool group : {false, true}) {
+                fs::remove_all(dir);
+                JournaledBank bank(dir, JournalOptions{group, 0});
+                double ms = runWorkload(bank, threads, opsPerThread);
+                cout << threads << "스레드, " << (group ? "그룹 커밋" : "거래마다 fsync") << ": " << ms << " ms ("
+                     << static_cast<long long>(threads * opsPerThread / ms * 1000) << "건/초)" << endl;
+                printMetrics(bank.metrics());
+            }
+        }
+
+        cout << "\n=== 주기적 스냅샷과 복구 시간 ===" << endl;
+        for (uint64_t every : {uint64_t(0), uint64_t(2000)}) {
+            fs::remove_all(dir);
+            {
+                JournaledBank bank(dir, JournalOptions{true, every});
+                runWorkload(bank, 16, 1000);
+            }
+            JournaledBank recovered(dir);
+            cout << (every ? "2000건마다 스냅샷" : "스냅샷 없음") << ":" << endl;
+            printRecovery(recovered.recoveryStats());
+        }
+
+        fs::remove_all(dir);
+    }
+    catch (const exception& e) {
+        cout << "예외 발생: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * 예외 없는 결과 타입 API
+ * 파일명: 19_result_bank_account.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 19_result_bank_account 19_result_bank_account.cpp
+ * 실행: ./19_result_bank_account (Linux/Mac) 또는 19_result_bank_account.exe (Windows)
+ */
+
+/*
+주제: 결과 타입 (Expected/Result)
+정의: 02_custom_exception.cpp의 BankAccount::withdraw는 잔액 부족과 잘못된 금액을 예외로 알린다.
+      거절이 드문 일이라면 괜찮지만, 시도의 20%가 거절되는 작업에서는 throw 한 번마다
+      예외 객체 할당, 메시지 문자열 생성, 스택 되감기(unwinding)로 마이크로초 단위의 비용이 든다.
+      tryWithdraw/tryDeposit은 성공 값 또는 오류 정보를 담은 Expected를 돌려주고,
+      기존 withdraw/deposit은 그 결과를 보고 예외를 던지는 얇은 포장이 된다.
+
+핵심 개념: Expected<T, E>, 오류 정보(payload), 얇은 포장
+정의:
+- Expected<T, E>: 값(T) 또는 오류(E) 중 하나를 담는다. C++23의 std::expected와 같은 모양이다
+- 오류 정보: BankError는 오류 종류와 함께 요청 금액, 잔액을 담아 예외 메시지와 같은 정보를 준다
+- 얇은 포장: 예외 API는 결과 API를 부르고 실패일 때만 해당 예외를 만든다. 규칙은 한 곳에만 있다
+- 메시지 문자열은 오류를 출력할 때(message())만 만들어지므로 실패 경로에서도 할당이 없다
+*/
+
+#include <iostream>
+#include <exception>
+#include <string>
+#include <variant>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <utility>
+#include <cstdint>
+using namespace std;
+
+// 02_custom_exception.cpp와 같은 예외 계층
+class BankException : public exception {
+private:
+    string message;
+
+public:
+    BankException(const string& msg) : message(msg) {}
+
+    const char* what() const noexcept override {
+        return message.c_str();
+    }
+};
+
+class InsufficientFundsException : public BankException {
+public:
+    InsufficientFundsException(double requested, double available)
+        : BankException("잔액 부족: 요청금액 " + to_string(requested) +
+                       "원, 잔액 " + to_string(available) + "원") {}
+};
+
+class InvalidAmountException : public BankException {
+public:
+    InvalidAmountException() : BankException("유효하지 않은 금액입니다.") {}
+};
+
+// 실패 표시용 태그 (std::unexpected에 해당)
+template<typename E>
+struct Unexpected {
+    E error;
+};
+
+template<typename E>
+Unexpected<E> makeUnexpected(E error) {
+    return Unexpected<E>{move(error)};
+}
+
+template<typename T, typename E>
+class Expected {
+private:
+    variant<T, E> storage;
+
+public:
+    Expected(T value) : storage(in_place_index<0>, move(value)) {}
+    Expected(Unexpected<E> failure) : storage(in_place_index<1>, move(failure.error)) {}
+
+    bool hasValue() const noexcept { return storage.index() == 0; }
+    explicit operator bool() const noexcept { return hasValue(); }
+
+    const T& value() const { return get<0>(storage); }
+    const T& operator*() const { return value(); }
+    const E& error() const { return get<1>(storage); }
+};
+
+// 오류 정보: 종류 + 예외 메시지에 쓰이던 값
+struct BankError {
+    enum class Code { InvalidAmount, InsufficientFunds };
+
+    Code code;
+    double requested = 0;
+    double available = 0;
+
+    string message() const {
+        if (code == Code::InvalidAmount) return "유효하지 않은 금액입니다.";
+        return "잔액 부족: 요청금액 " + to_string(requested) + "원, 잔액 " + to_string(available) + "원";
+    }
+
+    // 예외 API로 되돌릴 때 같은 예외 타입을 던진다
+    [[noreturn]] void raise() const {
+        if (code == Code::InvalidAmount) throw InvalidAmountException();
+        throw InsufficientFundsException(requested, available);
+    }
+};
+
+class BankAccount {
+private:
+    double balance;
+    bool printMessages;
+
+public:
+    BankAccount(double initial, bool verbose = true) : balance(initial), printMessages(verbose) {}
+
+    // 결과 API: 성공하면 거래 후 잔액, 실패하면 BankError (잔액은 그대로)
+    Expected<double, BankError> tryDeposit(double amount) noexcept {
+        if (!(amount > 0)) {
+            return makeUnexpected(BankError{BankError::Code::InvalidAmount, amount, balance});
+        }
+        balance += amount;
+        return balance;
+    }
+
+    Expected<double, BankError> tryWithdraw(double amount) noexcept {
+        if (!(amount > 0)) {
+            return makeUnexpected(BankError{BankError::Code::InvalidAmount, amount, balance});
+        }
+        if (amount > balance) {
+            return makeUnexpected(BankError{BankError::Code::InsufficientFunds, amount, balance});
+        }
+        balance -= amount;
+        return balance;
+    }
+
+    // 기존 예외 API: 결과 API 위의 얇은 포장
+    void deposit(double amount) {
+        auto result = tryDeposit(amount);
+        if (!result) result.error().raise();
+        if (printMessages) cout << amount << "원 입금 완료. 잔액: " << *result << "원" << endl;
+    }
+
+    void withdraw(double amount) {
+        auto result = tryWithdraw(amount);
+        if (!result) result.error().raise();
+        if (printMessages) cout << amount << "원 출금 완료. 잔액: " << *result << "원" << endl;
+    }
+
+    double getBalance() const { return balance; }
+};
+
+// 실패 비율이 failurePercent%인 출금 요청 목록 (실패의 절반은 잔액 부족, 절반은 잘못된 금액)
+vector<double> makeRequests(size_t count, int failurePercent) {
+    mt19937 rng(42);
+    vector<double> amounts(count);
+    for (double& amount : amounts) {
+        int roll = static_cast<int>(rng() % 1000);
+        if (roll < failurePercent * 5) amount = 1e12;        // 잔액 부족
+        else if (roll < failurePercent * 10) amount = -1;    // 잘못된 금액
+        else amount = 1.0;
+    }
+    return amounts;
+}
+
+int main() {
+    cout << "=== 결과 API ===" << endl;
+    BankAccount account(100000);
+
+    if (auto result = account.tryWithdraw(30000)) {
+        cout << "30000원 출금 성공. 잔액: " << *result << "원" << endl;
+    }
+    auto failed = account.tryWithdraw(200000);
+    if (!failed) {
+        const BankError& e = failed.error();
+        cout << "출금 실패: " << e.message() << endl;
+        cout << "  (부족한 금액: " << e.requested - e.available << "원)" << endl;
+    }
+    if (auto invalid = account.tryDeposit(-1000); !invalid) {
+        cout << "입금 실패: " << invalid.error().message() << endl;
+    }
+
+    cout << "\n=== 기존 예외 API (얇은 포장) ===" << endl;
+    try {
+        account.deposit(50000);
+        account.withdraw(30000);
+        account.withdraw(-1000);  // 잘못된 금액
+    }
+    catch (const InvalidAmountException& e) {
+        cout << "금액 오류: " << e.what() << endl;
+    }
+    catch (const BankException& e) {
+        cout << "은행 오류: " << e.what() << endl;
+    }
+    try {
+        account.withdraw(200000);  // 잔액 부족
+    }
+    catch (const InsufficientFundsException& e) {
+        cout << "잔액 오류: " << e.what() << endl;
+    }
+    cout << "최종 잔액: " << account.getBalance() << "원" << endl;
+
+    cout << "\n=== 실패 비율별 비용 (100만 건, 요청당 ns) ===" << endl;
+    const size_t COUNT = 1000000;
+    cout << "실패 비율 | 결과 API | 예외 API | 배율" << endl;
+    for (int failurePercent : {0, 1, 5, 20, 50}) {
+        vector<double> requests = makeRequests(COUNT, failurePercent);
+
+        BankAccount a(1e9, false), b(1e9, false);
+        size_t resultFailures = 0, exceptionFailures = 0;
+
+        auto start = chrono::steady_clock::now();
+        for (double amount : requests) {
+            if (!a.tryWithdraw(amount)) resultFailures++;
+        }
+        double resultNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / COUNT;
+
+        start = chrono::steady_clock::now();
+        for (double amount : requests) {
+            try {
+                b.withdraw(amount);
+            }
+            catch (const BankException&) {
+                exceptionFailures++;
+            }
+        }
+        double exceptionNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / COUNT;
+
+        cout << failurePercent << "% | " << resultNs << " | " << exceptionNs << " | " << exceptionNs / resultNs << "배";
+        if (resultFailures != exceptionFailures || a.getBalance() != b.getBalance()) cout << " (결과 불일치!)";
+        cout << endl;
+    }
+
+    return 0;
+}
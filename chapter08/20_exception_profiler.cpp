@@ -0,0 +1,544 @@
+/*
+ * 예외 비용 프로파일러
+ * 파일명: 20_exception_profiler.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -rdynamic -o 20_exception_profiler 20_exception_profiler.cpp -ldl
+ * 실행: ./20_exception_profiler (Linux, GCC/Clang)
+ */
+
+/*
+주제: 예외 비용 프로파일러 (Exception Profiler)
+정의: chapter08의 BankException, GameException, FileManager의 runtime_error는 흐름 제어에도 쓰이지만,
+      어느 throw 위치가 얼마나 자주 던지고 시간을 얼마나 쓰는지는 보이지 않는다.
+      ExceptionProfiler는 C++ ABI의 __cxa_allocate_exception, __cxa_throw, __cxa_begin_catch를
+      가로채어(interpose) 예외 클래스나 catch 문을 전혀 바꾸지 않고 타입별, 위치별 통계를 모은다.
+
+핵심 개념: ABI 가로채기, 던진 위치, 비용 측정, 순위 보고서
+정의:
+- ABI 가로채기: 실행 파일에 같은 이름의 함수를 정의하면 동적 링커가 그것을 먼저 찾는다.
+  기록만 하고 dlsym(RTLD_NEXT)로 찾은 원래 함수를 부르므로 catch 동작은 그대로다
+- 던진 위치: __cxa_throw를 부른 코드의 반환 주소. dladdr로 함수 이름을 찾고(-rdynamic 필요),
+  dladdr가 모르는 지역 심볼(컴파일러가 throw 경로를 떼어 낸 main.cold 등)과 줄 번호는
+  보고서를 만들 때 addr2line으로 찾는다(-g로 컴파일하면 인라인된 함수와 줄까지 나온다).
+  addr2line이 없으면 직접 실행할 명령을 보여 준다
+- 비용: 예외 객체 할당(메시지 생성 포함)부터 catch 블록 진입까지의 시간 = 생성 + 스택 되감기
+- 보고서: 총 비용 순으로 정렬한 위치별 표와 타입별 표. report()로 언제든, 프로그램 종료 시 자동으로 출력
+- 훅 안에서는 메모리를 할당하지 않는다 (bad_alloc을 던지는 중에도 안전하도록 고정 크기 표 사용)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include <typeinfo>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <dlfcn.h>
+#include <unistd.h>
+using namespace std;
+
+// <cxxabi.h>의 __cxa_throw 선언은 아래 훅과 충돌하므로 이름 복원 함수만 직접 선언한다
+extern "C" char* __cxa_demangle(const char* mangled, char* buffer, size_t* length, int* status);
+
+class ExceptionProfiler {
+public:
+    struct SiteStats {
+        const type_info* type = nullptr;
+        void* site = nullptr;
+        uint64_t throws = 0;
+        uint64_t caught = 0;        // catch까지 측정된 횟수 (잡히지 않은 예외는 제외)
+        uint64_t totalNs = 0;       // 할당 → catch
+        uint64_t unwindNs = 0;      // throw → catch
+        uint64_t maxNs = 0;
+    };
+
+private:
+    static constexpr size_t MAX_SITES = 256;
+
+    mutex lock;
+    SiteStats sites[MAX_SITES];
+    size_t siteCount = 0;
+    uint64_t overflowThrows = 0;    // 표가 가득 찬 뒤의 throw
+    atomic<bool> enabled{true};
+    bool reportAtExit = true;
+
+    // 스레드마다 "지금 날아가는 예외" 하나를 추적
+    struct InFlight {
+        int entry = -1;
+        chrono::steady_clock::time_point allocated;
+        chrono::steady_clock::time_point thrown;
+    };
+    static InFlight& current() {
+        static thread_local InFlight inFlight;
+        return inFlight;
+    }
+
+    int findOrAdd(const type_info* type, void* site) {
+        for (size_t i = 0; i < siteCount; i++) {
+            if (sites[i].site == site && (sites[i].type == type || *sites[i].type == *type)) {
+                return static_cast<int>(i);
+            }
+        }
+        if (siteCount == MAX_SITES) return -1;
+        sites[siteCount].type = type;
+        sites[siteCount].site = site;
+        return static_cast<int>(siteCount++);
+    }
+
+    static string demangle(const char* name) {
+        int status = 0;
+        char* readable = __cxa_demangle(name, nullptr, nullptr, &status);
+        string result = (status == 0 && readable) ? readable : name;
+        free(readable);
+        return result;
+    }
+
+    // addr2line으로 함수 이름과 "파일:줄"을 찾는다 (보고서에서만 호출하므로 할당/프로세스 생성 가능)
+    static bool addr2line(const string& modulePath, const char* offset, string& function, string& line) {
+        string command = "addr2line -f -C -e '" + modulePath + "' " + offset + " 2>/dev/null";
+        FILE* pipe = popen(command.c_str(), "r");
+        if (!pipe) return false;
+        string output[2];
+        char buffer[512];
+        for (string& text : output) {
+            if (!fgets(buffer, sizeof(buffer), pipe)) break;
+            text = buffer;
+            if (!text.empty() && text.back() == '\n') text.pop_back();
+        }
+        pclose(pipe);
+        if (output[0].empty() || output[0] == "??") return false;
+        function = output[0];
+        // 디버그 정보(-g)가 없으면 "파일:?" 또는 "??:0"이 나오므로 버린다
+        size_t colon = output[1].find_last_of(':');
+        if (output[1].rfind("??", 0) != 0 && colon != string::npos && output[1].compare(colon, 2, ":?") != 0) {
+            line = output[1].substr(output[1].find_last_of('/') + 1);
+        }
+        return true;
+    }
+
+    static string describeSite(void* site) {
+        Dl_info info{};
+        if (!dladdr(site, &info) || !info.dli_fname) return "알 수 없음";
+
+        // 실행 파일 자신이면 dli_fname이 argv[0]일 수 있으므로 /proc/self/exe가 가리키는 경로를 쓴다
+        string modulePath = info.dli_fname;
+        Dl_info self{};
+        if (dladdr(reinterpret_cast<void*>(&describeSite), &self) && self.dli_fbase == info.dli_fbase) {
+            char exe[4096];
+            ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+            if (n > 0) modulePath.assign(exe, static_cast<size_t>(n));
+        }
+        string module = info.dli_fname;
+        module = module.substr(module.find_last_of('/') + 1);
+
+        // 반환 주소는 call 다음 명령어이므로 1을 빼야 throw가 있는 줄이 나온다
+        char offset[32];
+        auto base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+        snprintf(offset, sizeof(offset), "0x%llx", static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(site) - base - 1));
+
+        string function = info.dli_sname ? demangle(info.dli_sname) : "";
+        string resolved, line;
+        if (addr2line(modulePath, offset, resolved, line) && function.empty()) {
+            function = resolved;
+        }
+        if (function.empty()) {
+            return "(이름 없음: addr2line -f -C -e " + module + " " + offset + ")";
+        }
+        const string cold = ".cold";
+        if (function.size() > cold.size() && function.compare(function.size() - cold.size(), cold.size(), cold) == 0) {
+            function = function.substr(0, function.size() - cold.size()) + " (cold 부분)";
+        }
+        if (function.size() > 60) function = function.substr(0, 57) + "...";
+        return function + " [" + module + "+" + offset + (line.empty() ? "" : ", " + line) + "]";
+    }
+
+    ExceptionProfiler() = default;
+
+public:
+    static ExceptionProfiler& instance() {
+        static ExceptionProfiler profiler;
+        return profiler;
+    }
+
+    void setEnabled(bool on) { enabled.store(on, memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(memory_order_relaxed); }
+    void setReportAtExit(bool on) { reportAtExit = on; }
+    bool shouldReportAtExit() const { return reportAtExit; }
+
+    // ---- ABI 훅에서 부르는 함수들 (할당 없음) ----
+    void onAllocate() {
+        if (!isEnabled()) return;
+        current().allocated = chrono::steady_clock::now();
+    }
+
+    void onThrow(const type_info* type, void* site) {
+        InFlight& f = current();
+        f.entry = -1;
+        if (!isEnabled()) return;
+        f.thrown = chrono::steady_clock::now();
+        lock_guard<mutex> guard(lock);
+        f.entry = findOrAdd(type, site);
+        if (f.entry < 0) {
+            overflowThrows++;
+            return;
+        }
+        sites[f.entry].throws++;
+    }
+
+    void onCatch() {
+        InFlight& f = current();
+        if (f.entry < 0) return;  // 다시 던진 예외, 프로파일러가 꺼져 있을 때 던진 예외 등
+        auto now = chrono::steady_clock::now();
+        uint64_t total = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(now - f.allocated).count());
+        uint64_t unwind = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(now - f.thrown).count());
+        if (f.allocated > f.thrown) total = unwind;  // 할당 훅을 거치지 않은 경우
+        {
+            lock_guard<mutex> guard(lock);
+            SiteStats& s = sites[f.entry];
+            s.caught++;
+            s.totalNs += total;
+            s.unwindNs += unwind;
+            s.maxNs = max(s.maxNs, total);
+        }
+        f.entry = -1;
+    }
+
+    // ---- 보고서 ----
+    vector<SiteStats> snapshot() {
+        lock_guard<mutex> guard(lock);
+        return vector<SiteStats>(sites, sites + siteCount);
+    }
+
+    void reset() {
+        lock_guard<mutex> guard(lock);
+        for (size_t i = 0; i < siteCount; i++) sites[i] = SiteStats{};
+        siteCount = 0;
+        overflowThrows = 0;
+    }
+
+    void report(ostream& out) {
+        bool wasEnabled = isEnabled();
+        setEnabled(false);  // 보고서를 만드는 동안의 예외는 세지 않는다
+
+        vector<SiteStats> stats = snapshot();
+        sort(stats.begin(), stats.end(), [](const SiteStats& a, const SiteStats& b) { return a.totalNs > b.totalNs; });
+
+        uint64_t throws = 0;
+        for (const auto& s : stats) throws += s.throws;
+        out << "=== 예외 프로파일: throw " << throws << "회, 위치 " << stats.size() << "곳 ===" << endl;
+        out << "순위 | throw | 평균 비용(us) | 되감기(us) | 최대(us) | 합계(ms) | 타입 | 위치" << endl;
+        int rank = 1;
+        for (const auto& s : stats) {
+            double caught = s.caught ? static_cast<double>(s.caught) : 1.0;
+            out << rank++ << " | " << s.throws << " | " << s.totalNs / caught / 1000.0 << " | "
+                << s.unwindNs / caught / 1000.0 << " | " << s.maxNs / 1000.0 << " | " << s.totalNs / 1e6
+                << " | " << demangle(s.type->name()) << " | " << describeSite(s.site) << endl;
+        }
+
+        map<string, pair<uint64_t, uint64_t>> byType;  // 타입 → (횟수, 합계 ns)
+        for (const auto& s : stats) {
+            auto& t = byType[demangle(s.type->name())];
+            t.first += s.throws;
+            t.second += s.totalNs;
+        }
+        vector<pair<string, pair<uint64_t, uint64_t>>> types(byType.begin(), byType.end());
+        sort(types.begin(), types.end(), [](const auto& a, const auto& b) { return a.second.second > b.second.second; });
+        out << "--- 타입별 ---" << endl;
+        for (const auto& [name, t] : types) {
+            out << name << ": " << t.first << "회, 합계 " << t.second / 1e6 << " ms" << endl;
+        }
+        if (overflowThrows) out << "(표가 가득 차서 세지 못한 throw " << overflowThrows << "회)" << endl;
+
+        setEnabled(wasEnabled);
+    }
+};
+
+// 프로그램 종료 시 자동 보고
+struct ExceptionReportAtExit {
+    ~ExceptionReportAtExit() {
+        ExceptionProfiler& profiler = ExceptionProfiler::instance();
+        if (profiler.shouldReportAtExit()) {
+            cout << "\n[종료 시 보고서]" << endl;
+            profiler.report(cout);
+        }
+    }
+};
+
+// ---- C++ ABI 가로채기 (Itanium C++ ABI: GCC, Clang) ----
+namespace {
+    template<typename Function>
+    Function nextSymbol(const char* name) {
+        void* symbol = dlsym(RTLD_NEXT, name);
+        if (!symbol) {
+            fprintf(stderr, "원래 %s를 찾을 수 없습니다\n", name);
+            abort();
+        }
+        return reinterpret_cast<Function>(symbol);
+    }
+}
+
+extern "C" {
+
+void* __cxa_allocate_exception(size_t size) noexcept {
+    using Original = void* (*)(size_t);
+    static Original original = nextSymbol<Original>("__cxa_allocate_exception");
+    ExceptionProfiler::instance().onAllocate();
+    return original(size);
+}
+
+// 컴파일러가 throw 식에 쓰는 내장 선언과 같은 모양 (두 번째 인자는 type_info*)
+void __cxa_throw(void* object, void* type, void (*destructor)(void*)) {
+    using Original = void (*)(void*, void*, void (*)(void*));
+    static Original original = nextSymbol<Original>("__cxa_throw");
+    ExceptionProfiler::instance().onThrow(static_cast<const type_info*>(type), __builtin_return_address(0));
+    original(object, type, destructor);
+    __builtin_unreachable();
+}
+
+void* __cxa_begin_catch(void* exception) noexcept {
+    using Original = void* (*)(void*);
+    static Original original = nextSymbol<Original>("__cxa_begin_catch");
+    ExceptionProfiler::instance().onCatch();
+    return original(exception);
+}
+
+} // extern "C"
+
+// ---- chapter08의 예외들을 던지는 코드 (원래 모양 그대로) ----
+
+// 02_custom_exception.cpp
+class BankException : public exception {
+private:
+    string message;
+
+public:
+    BankException(const string& msg) : message(msg) {}
+
+    const char* what() const noexcept override {
+        return message.c_str();
+    }
+};
+
+class InsufficientFundsException : public BankException {
+public:
+    InsufficientFundsException(double requested, double available)
+        : BankException("잔액 부족: 요청금액 " + to_string(requested) +
+                       "원, 잔액 " + to_string(available) + "원") {}
+};
+
+class InvalidAmountException : public BankException {
+public:
+    InvalidAmountException() : BankException("유효하지 않은 금액입니다.") {}
+};
+
+class BankAccount {
+private:
+    double balance;
+
+public:
+    BankAccount(double initial) : balance(initial) {}
+
+    void deposit(double amount) {
+        if (amount <= 0) {
+            throw InvalidAmountException();
+        }
+        balance += amount;
+    }
+
+    void withdraw(double amount) {
+        if (amount <= 0) {
+            throw InvalidAmountException();
+        }
+        if (amount > balance) {
+            throw InsufficientFundsException(amount, balance);
+        }
+        balance -= amount;
+    }
+
+    double getBalance() const { return balance; }
+};
+
+// 10_game_engine.cpp
+namespace GameEngine {
+    class GameException : public std::exception {
+    protected:
+        std::string message;
+    public:
+        explicit GameException(const std::string& msg) : message(msg) {}
+        const char* what() const noexcept override { return message.c_str(); }
+    };
+
+    class InvalidPositionException : public GameException {
+    public:
+        InvalidPositionException(float x, float y)
+            : GameException("잘못된 위치: (" + std::to_string(x) + ", " + std::to_string(y) + ")") {}
+    };
+
+    class GameObjectNotFoundException : public GameException {
+    public:
+        GameObjectNotFoundException(const std::string& name)
+            : GameException("게임 오브젝트를 찾을 수 없음: " + name) {}
+    };
+
+    class World {
+    private:
+        std::map<std::string, std::pair<float, float>> objects;
+
+    public:
+        void place(const std::string& name, float x, float y) {
+            if (x < 0 || y < 0 || x > 1000 || y > 1000) {
+                throw InvalidPositionException(x, y);
+            }
+            objects[name] = {x, y};
+        }
+
+        const std::pair<float, float>& find(const std::string& name) const {
+            auto it = objects.find(name);
+            if (it == objects.end()) {
+                throw GameObjectNotFoundException(name);
+            }
+            return it->second;
+        }
+    };
+}
+
+// 06_file_io_exception.cpp
+class FileManager {
+public:
+    static vector<string> readFile(const string& filename) {
+        ifstream file(filename);
+        if (!file.is_open()) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+
+        vector<string> lines;
+        string line;
+        while (getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    static void copyFile(const string& source, const string& destination) {
+        try {
+            auto content = readFile(source);
+            ofstream out(destination);
+            for (const auto& l : content) out << l << '\n';
+        }
+        catch (const exception& e) {
+            throw runtime_error("파일 복사 실패: " + string(e.what()));
+        }
+    }
+};
+
+int main() {
+    ExceptionProfiler& profiler = ExceptionProfiler::instance();
+    static ExceptionReportAtExit reportAtExit;
+
+    cout << "=== catch 동작은 그대로 ===" << endl;
+    BankAccount account(100000);
+    try {
+        account.withdraw(200000);
+    }
+    catch (const InsufficientFundsException& e) {
+        cout << "잔액 오류: " << e.what() << endl;
+    }
+    try {
+        FileManager::copyFile("없는_파일.txt", "복사본.txt");
+    }
+    catch (const runtime_error& e) {
+        cout << "파일 오류: " << e.what() << endl;
+    }
+    profiler.reset();
+
+    cout << "\n=== 작업 부하 ===" << endl;
+    // 은행: 출금 시도의 20%가 거절됨
+    size_t bankFailures = 0;
+    for (int i = 0; i < 20000; i++) {
+        try {
+            if (i % 10 == 3) account.withdraw(1e12);
+            else if (i % 10 == 7) account.deposit(-1);
+            else account.deposit(10);
+        }
+        catch (const BankException&) {
+            bankFailures++;
+        }
+    }
+
+    // 게임: 없는 오브젝트 조회와 화면 밖 위치
+    GameEngine::World world;
+    world.place("플레이어", 10, 10);
+    size_t gameFailures = 0;
+    for (int i = 0; i < 5000; i++) {
+        try {
+            world.find(i % 2 ? "플레이어" : "적" + to_string(i));
+            world.place("총알", static_cast<float>(i % 1500), 5);
+        }
+        catch (const GameEngine::GameException&) {
+            gameFailures++;
+        }
+    }
+
+    // 파일: 없는 파일 읽기 (copyFile은 잡아서 다시 던지므로 위치가 두 곳)
+    size_t fileFailures = 0;
+    for (int i = 0; i < 500; i++) {
+        try {
+            if (i % 2) FileManager::readFile("없는_파일.txt");
+            else FileManager::copyFile("없는_파일.txt", "복사본.txt");
+        }
+        catch (const runtime_error&) {
+            fileFailures++;
+        }
+    }
+
+    // 표준 라이브러리 안에서 던지는 예외도 잡힌다
+    size_t parseFailures = 0;
+    for (const char* text : {"95.5", "점수없음", "87", "abc", "", "100"}) {
+        try {
+            stod(text);
+        }
+        catch (const invalid_argument&) {
+            parseFailures++;
+        }
+    }
+    cout << "은행 실패 " << bankFailures << ", 게임 실패 " << gameFailures << ", 파일 실패 " << fileFailures
+         << ", 변환 실패 " << parseFailures << endl;
+
+    cout << endl;
+    profiler.report(cout);  // 필요할 때 보고서 출력
+
+    cout << "\n=== 프로파일러 자체의 비용 (BankException 10만 회) ===" << endl;
+    for (bool on : {false, true}) {
+        profiler.setEnabled(on);
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < 100000; i++) {
+            try {
+                account.withdraw(-1);
+            }
+            catch (const BankException&) {
+            }
+        }
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / 100000;
+        cout << (on ? "켜짐" : "꺼짐") << ": throw당 " << ns << " ns" << endl;
+    }
+    profiler.setEnabled(true);
+    profiler.reset();
+
+    // 종료 시 보고서에 남길 예외 하나
+    try {
+        world.find("보스");
+    }
+    catch (const GameEngine::GameObjectNotFoundException& e) {
+        cout << "\n" << e.what() << endl;
+    }
+
+    return 0;
+}
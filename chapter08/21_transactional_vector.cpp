@@ -0,0 +1,333 @@
+/*
+ * 되돌리기 기록을 쓰는 트랜잭션 벡터
+ * 파일명: 21_transactional_vector.cpp
+ *
+ * 컴파일: g++ -std=c++17 -O2 -o 21_transactional_vector 21_transactional_vector.cpp
+ * 실행: ./21_transactional_vector (Linux/Mac) 또는 21_transactional_vector.exe (Windows)
+ */
+
+/*
+주제: 되돌리기 기록 (Undo Log)
+정의: 03_exception_safety.cpp의 strongExceptionSafety()는 작업 전에 vector<int> data 전체를
+      backup으로 복사하여 강한 예외 안전성을 얻는다. 원소가 n개면 작업마다 O(n)의 복사가 든다.
+      TransactionalVector는 실제로 바뀐 것(push_back, erase, 원소 쓰기)의 이전 상태만 기록하고,
+      예외가 나면 기록을 거꾸로 적용하여 O(변경 수)로 되돌린다.
+
+핵심 개념: 되돌리기 기록, 세이브포인트, 트랜잭션 가드
+정의:
+- 되돌리기 기록: 변경 하나마다 "어떻게 되돌리는지"를 남긴다. erase와 원소 쓰기는 이전 값을 복사하지 않고 옮겨(move) 둔다
+- 세이브포인트: 기록의 현재 길이. rollbackTo(세이브포인트)는 그 이후의 변경만 되돌리므로 중첩할 수 있다
+- 트랜잭션 가드: commit() 없이 소멸하면(예외로 빠져나가면) 자동으로 되돌린다
+- 되돌리기는 예외를 던지지 않는다: 원소 타입의 이동이 noexcept이고, 되돌릴 때는 용량이 이미 충분하므로
+  재할당이 없다. 중간 삽입/삭제를 되돌리는 비용은 원래 삽입/삭제와 같다
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <chrono>
+#include <algorithm>
+using namespace std;
+
+template<typename T>
+class TransactionalVector {
+    static_assert(is_nothrow_move_constructible<T>::value && is_nothrow_move_assignable<T>::value,
+                  "되돌리기가 예외 없이 끝나려면 원소의 이동이 noexcept여야 합니다");
+
+private:
+    enum class UndoKind { PushBack, PopBack, Insert, Erase, Assign };
+
+    struct UndoEntry {
+        UndoKind kind;
+        size_t index;
+        optional<T> oldValue;  // PopBack, Erase, Assign일 때 이전 값
+    };
+
+    vector<T> data;
+    vector<UndoEntry> undoLog;
+    size_t depth = 0;  // 열려 있는 세이브포인트 수. 0이면 기록하지 않는다
+
+    bool recording() const { return depth > 0; }
+
+    // 기록 공간을 먼저 확보한다. 이전 값을 기록으로 옮긴 뒤에 기록의 재할당이 실패하면
+    // 원래 값을 잃게 되므로, 실패할 수 있는 일은 옮기기 전에 끝낸다
+    bool prepareLog() {
+        if (!recording()) return false;
+        if (undoLog.size() == undoLog.capacity()) undoLog.reserve(max<size_t>(16, undoLog.capacity() * 2));
+        return true;
+    }
+
+    void undo(UndoEntry& entry) noexcept {
+        switch (entry.kind) {
+            case UndoKind::PushBack:
+                data.pop_back();
+                break;
+            case UndoKind::PopBack:
+                data.push_back(move(*entry.oldValue));  // pop_back 뒤라 용량이 남아 있다
+                break;
+            case UndoKind::Insert:
+                data.erase(data.begin() + static_cast<ptrdiff_t>(entry.index));
+                break;
+            case UndoKind::Erase:
+                data.insert(data.begin() + static_cast<ptrdiff_t>(entry.index), move(*entry.oldValue));
+                break;
+            case UndoKind::Assign:
+                data[entry.index] = move(*entry.oldValue);
+                break;
+        }
+    }
+
+    void checkIndex(size_t index, size_t limit) const {
+        if (index >= limit) throw out_of_range("TransactionalVector: 인덱스 범위 초과");
+    }
+
+public:
+    TransactionalVector() = default;
+    TransactionalVector(initializer_list<T> init) : data(init) {}
+    explicit TransactionalVector(vector<T> values) : data(move(values)) {}
+
+    // ---- 읽기 ----
+    size_t size() const noexcept { return data.size(); }
+    bool empty() const noexcept { return data.empty(); }
+    const T& operator[](size_t index) const { return data[index]; }
+    const T& at(size_t index) const { return data.at(index); }
+    typename vector<T>::const_iterator begin() const noexcept { return data.begin(); }
+    typename vector<T>::const_iterator end() const noexcept { return data.end(); }
+    const vector<T>& values() const noexcept { return data; }
+    size_t pendingChanges() const noexcept { return undoLog.size(); }
+
+    // 용량만 바꾸므로 기록하지 않는다
+    void reserve(size_t capacity) { data.reserve(capacity); }
+
+    // ---- 변경 (각각 강한 예외 안전성: 실패하면 벡터와 기록 모두 그대로) ----
+    void push_back(T value) {
+        if (recording()) undoLog.push_back({UndoKind::PushBack, data.size(), nullopt});
+        try {
+            data.push_back(move(value));
+        }
+        catch (...) {
+            if (recording()) undoLog.pop_back();
+            throw;
+        }
+    }
+
+    void pop_back() {
+        if (data.empty()) throw out_of_range("TransactionalVector: 빈 벡터에서 pop_back");
+        if (prepareLog()) undoLog.push_back({UndoKind::PopBack, data.size() - 1, move(data.back())});
+        data.pop_back();
+    }
+
+    void insert(size_t index, T value) {
+        checkIndex(index, data.size() + 1);
+        if (recording()) undoLog.push_back({UndoKind::Insert, index, nullopt});
+        try {
+            data.insert(data.begin() + static_cast<ptrdiff_t>(index), move(value));
+        }
+        catch (...) {
+            if (recording()) undoLog.pop_back();
+            throw;
+        }
+    }
+
+    void erase(size_t index) {
+        checkIndex(index, data.size());
+        if (prepareLog()) undoLog.push_back({UndoKind::Erase, index, move(data[index])});
+        data.erase(data.begin() + static_cast<ptrdiff_t>(index));
+    }
+
+    // 원소 쓰기: 이전 값을 기록으로 옮긴 뒤 새 값을 넣는다
+    void set(size_t index, T value) {
+        checkIndex(index, data.size());
+        if (prepareLog()) undoLog.push_back({UndoKind::Assign, index, move(data[index])});
+        data[index] = move(value);
+    }
+
+    // ---- 세이브포인트 ----
+    class Savepoint {
+        friend class TransactionalVector;
+        size_t mark;
+        explicit Savepoint(size_t m) : mark(m) {}
+    };
+
+    Savepoint savepoint() {
+        depth++;
+        return Savepoint(undoLog.size());
+    }
+
+    // 세이브포인트 이후의 변경을 거꾸로 되돌린다 (O(변경 수))
+    void rollbackTo(const Savepoint& point) noexcept {
+        while (undoLog.size() > point.mark) {
+            undo(undoLog.back());
+            undoLog.pop_back();
+        }
+        closeSavepoint();
+    }
+
+    // 변경을 유지한다. 바깥 세이브포인트가 남아 있으면 그쪽에서 여전히 되돌릴 수 있다
+    void release(const Savepoint&) noexcept {
+        closeSavepoint();
+    }
+
+private:
+    void closeSavepoint() noexcept {
+        if (depth > 0 && --depth == 0) undoLog.clear();  // 가장 바깥에서 끝나면 기록은 필요 없다
+    }
+
+public:
+    // commit() 없이 소멸하면 자동으로 되돌리는 가드
+    class Transaction {
+    private:
+        TransactionalVector* owner;
+        Savepoint point;
+
+    public:
+        explicit Transaction(TransactionalVector& v) : owner(&v), point(v.savepoint()) {}
+        ~Transaction() {
+            if (owner) owner->rollbackTo(point);
+        }
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+
+        void commit() noexcept {
+            if (owner) owner->release(point);
+            owner = nullptr;
+        }
+        void rollback() noexcept {
+            if (owner) owner->rollbackTo(point);
+            owner = nullptr;
+        }
+    };
+
+    Transaction transaction() { return Transaction(*this); }
+};
+
+template<typename T>
+void printValues(const string& label, const TransactionalVector<T>& v) {
+    cout << label << ": ";
+    for (const auto& x : v) cout << x << " ";
+    cout << endl;
+}
+
+// 03_exception_safety.cpp의 strongExceptionSafety를 되돌리기 기록으로
+void strongExceptionSafety(TransactionalVector<int>& data) {
+    auto tx = data.transaction();  // 백업 복사 대신 세이브포인트
+
+    // 위험한 작업 시뮬레이션
+    data.push_back(6);
+    data.push_back(7);
+
+    // 예외 발생 시뮬레이션
+    if (data.size() > 6) {
+        cout << "오류 발생, 원래 상태로 복원 (되돌릴 변경 " << data.pendingChanges() << "개)" << endl;
+        throw runtime_error("데이터 처리 오류!");  // tx 소멸자가 되돌린다
+    }
+
+    tx.commit();
+    cout << "작업 성공!" << endl;
+}
+
+// 비교용: 전체 복사 백업
+void copyBackupEdit(vector<int>& data, size_t edits, bool fail) {
+    vector<int> backup = data;
+    try {
+        for (size_t i = 0; i < edits; i++) data[(i * 7919) % data.size()] += 1;
+        data.push_back(1);
+        if (fail) throw runtime_error("실패");
+    }
+    catch (...) {
+        data = backup;
+    }
+}
+
+void undoLogEdit(TransactionalVector<int>& data, size_t edits, bool fail) {
+    try {
+        auto tx = data.transaction();
+        for (size_t i = 0; i < edits; i++) {
+            size_t index = (i * 7919) % data.size();
+            data.set(index, data[index] + 1);
+        }
+        data.push_back(1);
+        if (fail) throw runtime_error("실패");
+        tx.commit();
+    }
+    catch (...) {
+    }
+}
+
+int main() {
+    cout << "=== 강한 예외 안전성 (백업 복사 없이) ===" << endl;
+    TransactionalVector<int> data = {1, 2, 3, 4, 5};
+    try {
+        strongExceptionSafety(data);
+    }
+    catch (const exception& e) {
+        cout << "최종 오류: " << e.what() << endl;
+    }
+    printValues("복원된 데이터", data);
+
+    cout << "\n=== 중첩 세이브포인트 ===" << endl;
+    TransactionalVector<string> names = {"김철수", "이영희", "박민수"};
+    {
+        auto outer = names.transaction();
+        names.set(0, "김철수(수정)");
+        names.erase(1);
+
+        try {
+            auto inner = names.transaction();
+            names.push_back("최정화");
+            names.insert(0, "강하늘");
+            printValues("안쪽 작업 중", names);
+            throw runtime_error("안쪽 작업 실패");
+        }
+        catch (const exception& e) {
+            cout << e.what() << " → 안쪽 변경만 되돌림" << endl;
+        }
+        printValues("바깥 작업 중", names);
+        outer.rollback();
+    }
+    printValues("바깥까지 되돌린 뒤", names);
+    {
+        auto tx = names.transaction();
+        names.pop_back();
+        names.push_back("윤서연");
+        tx.commit();
+    }
+    printValues("커밋 후", names);
+
+    cout << "\n=== 큰 벡터의 작은 수정 (트랜잭션당 us) ===" << endl;
+    cout << "원소 수 | 수정 수 | 결과 | 전체 복사 | 되돌리기 기록" << endl;
+    for (size_t n : {1000, 100000, 1000000}) {
+        for (bool fail : {false, true}) {
+            const size_t EDITS = 10;
+            int rounds = n >= 1000000 ? 200 : 2000;
+            vector<int> plain(n, 0);
+            TransactionalVector<int> tracked(vector<int>(n, 0));
+            plain.reserve(n + 1);  // 첫 push_back의 재할당을 측정에서 제외
+            tracked.reserve(n + 1);
+
+            auto start = chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++) {
+                copyBackupEdit(plain, EDITS, fail);
+                if (plain.size() > n) plain.pop_back();
+            }
+            double copyUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / rounds;
+
+            start = chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++) {
+                undoLogEdit(tracked, EDITS, fail);
+                if (tracked.size() > n) tracked.pop_back();
+            }
+            double undoUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / rounds;
+
+            cout << n << " | " << EDITS << " | " << (fail ? "실패" : "성공") << " | " << copyUs << " | " << undoUs;
+            if (plain != tracked.values()) cout << " (결과 불일치!)";
+            cout << endl;
+        }
+    }
+
+    return 0;
+}